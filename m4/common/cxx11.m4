@@ -129,3 +129,61 @@ AC_DEFUN([QUESO_TEST_CXX11_SHARED_PTR],
 
     AM_CONDITIONAL(HAVE_CXX11_SHARED_PTR, test x$have_cxx11_shared_ptr == xyes)
   ])
+
+AC_DEFUN([QUESO_TEST_CXX11_THREAD],
+  [
+    have_cxx11_thread=no
+
+    # Only run the test if enablecxx11==yes
+    if (test "x$enablecxx11" = "xyes"); then
+      AC_MSG_CHECKING(for C++11 std::thread support)
+      AC_LANG_PUSH([C++])
+
+      m4_define([queso_cxx11_thread_program],
+        [AC_LANG_PROGRAM([[
+      @%:@include <thread>
+      @%:@include <mutex>
+      @%:@include <condition_variable>
+      std::mutex m;
+      std::condition_variable cv;
+      bool done = false;
+      void work()
+      {
+        std::unique_lock<std::mutex> lock(m);
+        done = true;
+        cv.notify_all();
+      }
+          ]], [[
+      std::thread t(work);
+      {
+        std::unique_lock<std::mutex> lock(m);
+        while (!done) cv.wait(lock);
+      }
+      t.join();
+      ]])])
+
+      # Some toolchains only link std::thread with -pthread
+      AC_LINK_IFELSE([queso_cxx11_thread_program],[
+        have_cxx11_thread=yes
+      ],[
+        queso_save_LIBS="$LIBS"
+        LIBS="$LIBS -pthread"
+        AC_LINK_IFELSE([queso_cxx11_thread_program],[
+          have_cxx11_thread=yes
+        ],[
+          LIBS="$queso_save_LIBS"
+        ])
+      ])
+
+      if (test "x$have_cxx11_thread" = "xyes"); then
+        AC_MSG_RESULT(yes)
+        AC_DEFINE(HAVE_CXX11_THREAD, 1, [Flag indicating whether compiler supports std::thread])
+      else
+        AC_MSG_RESULT(no)
+      fi
+
+      AC_LANG_POP([C++])
+    fi
+
+    AM_CONDITIONAL(HAVE_CXX11_THREAD, test x$have_cxx11_thread == xyes)
+  ])
@@ -84,6 +84,12 @@ else
   echo '   'Link with HDF5............. : yes
 fi
 
+if test "$HAVE_LAPACKE" = "0"; then
+  echo '   'Link with LAPACKE.......... : no
+else
+  echo '   'Link with LAPACKE.......... : yes
+fi
+
 if test "$HAVE_TRILINOS" == "0"; then
   echo '   'Link with Trilinos......... : no
 else
@@ -125,6 +131,10 @@ if test "$HAVE_GLPK" = "1"; then
    echo '   'GLPK DIR................... : $GLPK_PREFIX
 fi
 
+if test "$HAVE_LAPACKE" = "1"; then
+   echo '   'LAPACKE_LIBS............... : $LAPACKE_LIBS
+fi
+
 if test "$HAVE_TRILINOS" = "1"; then
    echo '   'Trilinos DIR............... : $TRILINOS_HOME
 fi
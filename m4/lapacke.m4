@@ -0,0 +1,82 @@
+# SYNOPSIS
+#
+#   Test for LAPACKE
+#
+#   AX_PATH_LAPACKE
+#
+# DESCRIPTION
+#
+#   Provides a --with-lapacke[=LIBS] option.  When given, GslMatrix
+#   dispatches its Cholesky, LU, symmetric eigenvalue and SVD
+#   factorizations to LAPACKE (potrf, getrf, syevd and gesdd) instead of
+#   GSL's reference routines.  LIBS defaults to "-llapacke -llapack -lblas";
+#   pass e.g. --with-lapacke="-lopenblas" for a threaded BLAS.  The
+#   LAPACKE_CFLAGS and LAPACKE_LIBS variables override the search.
+#
+#   GSL's own BLAS calls go to whatever CBLAS GSL_LIBS names, so
+#   setting GSL_LIBS="-lgsl -lopenblas" moves those to the same library.
+#
+#   Configure fails if --with-lapacke was given but LAPACKE cannot be
+#   linked.  On success, sets LAPACKE_CFLAGS, LAPACKE_LIBS, and
+#   #defines HAVE_LAPACKE.
+#
+# LAST MODIFICATION
+#
+#   2026-10-17
+
+AC_DEFUN([AX_PATH_LAPACKE],
+[
+
+AC_ARG_WITH([lapacke],
+            AS_HELP_STRING([--with-lapacke@<:@=LIBS@:>@],
+                           [use LAPACKE for GslMatrix factorizations @<:@default=no@:>@]),
+            [with_lapacke=$withval],
+            [with_lapacke=no])
+
+AC_ARG_VAR(LAPACKE_CFLAGS,[C preprocessor flags for the LAPACKE headers])
+AC_ARG_VAR(LAPACKE_LIBS,[linker flags for LAPACKE and the BLAS it uses])
+
+HAVE_LAPACKE=0
+
+if test "x$with_lapacke" != "xno"; then
+
+  if test "x$LAPACKE_LIBS" = "x"; then
+    if test "x$with_lapacke" = "xyes"; then
+      LAPACKE_LIBS="-llapacke -llapack -lblas"
+    else
+      LAPACKE_LIBS="$with_lapacke"
+    fi
+  fi
+
+  ac_lapacke_save_CPPFLAGS="$CPPFLAGS"
+  ac_lapacke_save_LIBS="$LIBS"
+  CPPFLAGS="${LAPACKE_CFLAGS} ${CPPFLAGS}"
+  LIBS="${LAPACKE_LIBS} ${LIBS}"
+
+  AC_MSG_CHECKING(for LAPACKE)
+
+  AC_LANG_PUSH([C])
+  AC_LINK_IFELSE( [AC_LANG_PROGRAM([#include <lapacke.h>],
+                                   [double a = 4.0;
+                                    return (int) LAPACKE_dpotrf(LAPACK_COL_MAJOR, 'U', 1, &a, 1);])],
+                                   [AC_MSG_RESULT(yes)
+                                    HAVE_LAPACKE=1],
+                                   [AC_MSG_RESULT(no)
+                                    AC_MSG_ERROR([--with-lapacke was given, but LAPACKE could not be linked with: ${LAPACKE_LIBS}])] )
+  AC_LANG_POP([C])
+
+  CPPFLAGS="$ac_lapacke_save_CPPFLAGS"
+  LIBS="$ac_lapacke_save_LIBS"
+fi
+
+if test "x${HAVE_LAPACKE}" = "x1"; then
+  AC_DEFINE(HAVE_LAPACKE,1,[Define if GslMatrix factorizations use LAPACKE])
+else
+  LAPACKE_CFLAGS=""
+  LAPACKE_LIBS=""
+fi
+AC_SUBST(HAVE_LAPACKE)
+AC_SUBST(LAPACKE_CFLAGS)
+AC_SUBST(LAPACKE_LIBS)
+AM_CONDITIONAL(LAPACKE_ENABLED,test x$HAVE_LAPACKE = x1)
+])
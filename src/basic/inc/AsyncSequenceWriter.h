@@ -0,0 +1,170 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_ASYNC_SEQUENCE_WRITER_H
+#define UQ_ASYNC_SEQUENCE_WRITER_H
+
+#include <queso/Environment.h>
+#include <queso/FilePtr.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#ifdef QUESO_HAVE_CXX11_THREAD
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#endif
+
+namespace QUESO {
+
+/*!
+ * \file AsyncSequenceWriter.h
+ * \brief A class that appends sequence positions to a sub output file in the background.
+ *
+ * \class AsyncSequenceWriter
+ * \brief A class that appends sequence positions to a sub output file in the background.
+ *
+ * This class is meant for periodic output of a sequence that is still being generated, such as
+ * the raw chain of MetropolisHastingsSG.  The output file is opened once, in append mode, and
+ * stays open until close() is called.  Positions are appended one at a time into a fill buffer;
+ * submit() hands the filled block over to a writer thread, which formats and writes it while the
+ * caller keeps filling the other buffer.  The caller only waits if the previous block is still
+ * being written.  No communication among processes is involved.
+ *
+ * The file contents are the same as those written by SequenceOfVectors::subWriteContents() and
+ * ScalarSequence::subWriteContents() over the whole sequence.  In 'h5' format a dataset of the
+ * final size is created when the file is opened and every block is written into its hyperslab;
+ * 'bin' files (see BinaryChainFile) are filled in the same way.
+ *
+ * The rest of the library calls HDF5 from the main thread without any lock, so 'h5' files are
+ * only written in the background if H5is_library_threadsafe() reports an HDF5 that serializes
+ * its own calls.  An exception thrown while the writer thread writes a block is rethrown by
+ * close(); later blocks are then dropped.
+ *
+ * When the library is built without C++11 thread support, or for 'h5' files with an HDF5 that is
+ * not thread safe, submit() writes the block itself.
+ */
+class AsyncSequenceWriter
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor.
+  /*! Opens the sub output file '\<fileName\>_sub\<subId\>.\<fileType\>' if this process is allowed
+   * to write it, see BaseEnvironment::openOutputFile().  \c sequenceSize is the final size of the
+   * sequence, and \c numColumns the number of values per position.  Scalar sequences are
+   * formatted as in ScalarSequence, and vector sequences as in SequenceOfVectors. */
+  AsyncSequenceWriter(const BaseEnvironment&        env,
+                      const std::string&            sequenceName,
+                      unsigned int                  sequenceSize,
+                      unsigned int                  numColumns,
+                      bool                          isScalarSequence,
+                      const std::string&            fileName,
+                      const std::string&            fileType,
+                      const std::set<unsigned int>& allowedSubEnvIds);
+
+  //! Destructor; calls close(), reporting rather than throwing any write error.
+  ~AsyncSequenceWriter();
+  //@}
+
+  //! @name Output methods
+  //@{
+  //! Whether this process writes the file.  If not, all other methods do nothing.
+  bool         isWriting     () const;
+
+  //! Appends the values of \c vec as the next position of the sequence.
+  template <class V>
+  void         append        (const V& vec)
+  {
+    if (!m_isWriting) return;
+    double* row = this->nextRow();
+    for (unsigned int i = 0; i < m_numColumns; ++i) {
+      row[i] = vec[i];
+    }
+  }
+
+  //! Appends \c value as the next position of a scalar sequence.
+  void         append        (double value);
+
+  //! Hands all positions appended since the last call over to the writer.
+  void         submit        ();
+
+  //! Submits the remaining positions, waits until they are written and closes the file.
+  /*! Rethrows the first exception the writer thread caught, once the file is closed. */
+  void         close         ();
+
+  //! Number of positions already written to the file.
+  unsigned int numRowsWritten() const;
+  //@}
+
+private:
+  //! Returns space for one more position in the fill buffer.
+  double*      nextRow       ();
+
+  //! Writes one block of positions to the file.
+  void         writeBlock    (const std::vector<double>& block);
+
+#ifdef QUESO_HAVE_CXX11_THREAD
+  //! Body of the writer thread.
+  void         writerLoop    ();
+
+  std::thread             m_thread;
+  mutable std::mutex      m_mutex;
+  std::condition_variable m_cond;
+  bool                    m_blockPending;
+  bool                    m_stop;
+
+  // First exception thrown by writeBlock() in the writer thread
+  std::exception_ptr      m_writerError;
+
+  // Whether the writer thread runs; false if submit() writes the blocks itself
+  bool                    m_writeInBackground;
+#endif
+
+  const BaseEnvironment& m_env;
+  std::string            m_sequenceName;
+  unsigned int           m_sequenceSize;
+  unsigned int           m_numColumns;
+  bool                   m_isScalarSequence;
+  std::string            m_fileType;
+  FilePtrSetStruct       m_filePtrSet;
+  bool                   m_isWriting;
+  unsigned int           m_numRowsWritten;
+
+  // Double buffer: the caller fills m_fillBuffer while the writer thread
+  // drains m_writeBuffer
+  std::vector<double>    m_fillBuffer;
+  std::vector<double>    m_writeBuffer;
+
+#ifdef QUESO_HAS_HDF5
+  hid_t                  m_h5DatasetId;
+#endif
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_ASYNC_SEQUENCE_WRITER_H
@@ -0,0 +1,158 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_BINARY_CHAIN_FILE_H
+#define UQ_BINARY_CHAIN_FILE_H
+
+#include <queso/ScalarSequence.h>
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace QUESO {
+
+/*!
+ * \file BinaryChainFile.h
+ * \brief Native binary format for sequence files.
+ *
+ * \class BinaryChainFile
+ * \brief A memory mapped, read-only view of a sequence written in the 'bin' format.
+ *
+ * A 'bin' file holds one sequence of \c sequenceSize positions with \c numParams values each.
+ * It starts with a 64 byte header:
+ *
+ * \verbatim
+ *   offset  0: char[8]  "QUESOBIN"
+ *   offset  8: uint32   format version (1)
+ *   offset 12: uint32   header size in bytes (64)
+ *   offset 16: uint64   sequence size
+ *   offset 24: uint64   number of parameters
+ *   offset 32: uint64   number of positions written so far
+ * \endverbatim
+ *
+ * followed by the values as a column-major block of doubles: column \c j, i.e. all positions of
+ * parameter \c j, starts at byte 64 + 8 * j * sequenceSize.  Values are stored in the native byte
+ * order; a file written with the other byte order is rejected because its version does not read
+ * as 1.
+ *
+ * The whole block is allocated when the header is written, and positions are then written in
+ * chunks of consecutive rows, so a sequence can be appended to while it is being generated.
+ *
+ * Reading maps the file into memory: nothing is parsed, a parameter is a contiguous array, and
+ * only the pages actually touched are read from disk.
+ */
+class BinaryChainFile
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Maps the file \c fileName, which should include the extension.
+  BinaryChainFile(const std::string& fileName);
+
+  //! Destructor; unmaps the file.
+  ~BinaryChainFile();
+  //@}
+
+  //! @name Accessor methods
+  //@{
+  //! Size of the sequence the file was created for.
+  unsigned int  sequenceSize  () const;
+
+  //! Number of values per position.
+  unsigned int  numParams     () const;
+
+  //! Number of positions written to the file.
+  unsigned int  numPositions  () const;
+
+  //! All \c sequenceSize values of parameter \c paramId.
+  const double* column        (unsigned int paramId) const;
+  //@}
+
+  //! @name Extraction methods
+  //@{
+  //! Copies positions [\c initialPos, \c initialPos + \c numPos) into the row-major array \c rows.
+  void          getRows       (unsigned int initialPos,
+                               unsigned int numPos,
+                               double*      rows) const;
+
+  //! Extracts the values of parameter \c paramId, as SequenceOfVectors::extractScalarSeq() does.
+  void          extractScalarSeq(unsigned int            initialPos,
+                                 unsigned int            spacing,
+                                 unsigned int            numPos,
+                                 unsigned int            paramId,
+                                 ScalarSequence<double>& scalarSeq) const;
+  //@}
+
+  //! @name Writing methods
+  //@{
+  //! Writes the header and allocates the value block of a new file.
+  /*! \c os should be a binary stream positioned anywhere in the file. */
+  static void   writeHeader   (std::ostream& os,
+                               unsigned int  sequenceSize,
+                               unsigned int  numParams);
+
+  //! Writes positions [\c initialPos, \c initialPos + \c numPos) from the row-major array \c rows.
+  /*! The header should have been written already with the same sizes.  The number of positions
+   * written is set to \c initialPos + \c numPos. */
+  static void   writeRows     (std::ostream& os,
+                               unsigned int  sequenceSize,
+                               unsigned int  numParams,
+                               unsigned int  initialPos,
+                               unsigned int  numPos,
+                               const double* rows);
+
+  //! Writes the sub sequences of all processes in 'inter0Comm', one after the other, to '\<fileName\>.bin'.
+  /*! Called by the unifiedWriteContents() methods of the sequence classes, on processes with
+   * inter0Rank >= 0.  Sub sequences may have different sizes. */
+  static void   unifiedWrite  (const BaseEnvironment& env,
+                               const std::string&     fileName,
+                               unsigned int           numParams,
+                               unsigned int           subSequenceSize,
+                               const double*          rows);
+
+  //! Reads the sub sequence of this process from the unified file '\<fileName\>.bin'.
+  /*! Process of inter0Rank \c r gets positions [r * \c subReadSize, (r+1) * \c subReadSize), as
+   * with the other formats.  All processes map the file at once. */
+  static void   unifiedRead   (const BaseEnvironment& env,
+                               const std::string&     fileName,
+                               unsigned int           numParams,
+                               unsigned int           subReadSize,
+                               double*                rows);
+  //@}
+
+private:
+  std::string   m_fileName;
+  int           m_fd;
+  void*         m_map;
+  std::size_t   m_mapSize;
+  unsigned int  m_sequenceSize;
+  unsigned int  m_numParams;
+  unsigned int  m_numPositions;
+  const double* m_data;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_BINARY_CHAIN_FILE_H
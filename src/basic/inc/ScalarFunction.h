@@ -129,6 +129,19 @@ public:
                          const V & domainDirection,
                          V & hessianEffect) const;
 
+  //! Returns the logarithm of the function at each point of \c domainVectors
+  /*!
+   * On return \c values has the same size as \c domainVectors, and
+   * \c values[i] is the logarithm of the function at \c *domainVectors[i].
+   *
+   * Default implementation calls lnValue(const V &) once per point.  Functions
+   * that vectorise well across points should override this method: batched
+   * samplers such as PopulationMetropolisHastingsSG hand all their candidates
+   * to the target in one call.
+   */
+  virtual void lnValues(const std::vector<const V *> & domainVectors,
+                        std::vector<double> & values) const;
+
   //! Actual value of the scalar function.
   virtual double actualValue(const V & domainVector, const V * domainDirection,
       V * gradVector, M * hessianMatrix, V * hessianEffect) const = 0;
@@ -81,6 +81,14 @@ public:
   double callFunction(const V* vecValues,
                       double* extraOutput1,
                       double* extraOutput2) const;
+
+  //! Calls the scalar function at a batch of points.
+  /*! When every process of the subenvironment evaluates the function itself, the whole batch is
+   * handed to BaseScalarFunction::lnValues() at once.  Otherwise the points are broadcast and
+   * evaluated one at a time through callFunction(), and, as usual, the processes with nonzero
+   * subRank must be waiting inside callFunction() with a NULL \c vecValues. */
+  void   callFunctions(const std::vector<const V*>& vecValues,
+                             std::vector<double>&   values) const;
   //@}
 private:
   const BaseEnvironment&         m_env;
@@ -27,7 +27,6 @@
 
 #include <queso/VectorSequence.h>
 #define UQ_SEQ_VEC_USES_SCALAR_SEQ_CODE
-#undef  UQ_SEQ_VEC_USES_OPERATOR
 
 namespace QUESO {
 
@@ -43,19 +42,17 @@ class GslMatrix;
  * This class handles vector samples generated by an algorithm, as well as
  * operations that can be carried over them, e.g., calculation of means,
  * correlation and covariance matrices. It is derived from and implements
- * BaseVectorSequence<V,M>.*/
+ * BaseVectorSequence<V,M>.
+ *
+ * Positions are stored in a single contiguous, row-major buffer of
+ * subSequenceSize() x vectorSizeLocal() doubles, so that setting or getting
+ * a position does not allocate and column extraction is a strided read.*/
 
 template <class V = GslVector, class M = GslMatrix>
 class SequenceOfVectors : public BaseVectorSequence<V,M>
 {
 public:
 
-  //! @name Class typedefs
-  //@{
-  typedef typename std::vector<const V*>::const_iterator seqVectorPositionConstIteratorTypedef;
-  typedef typename std::vector<const V*>::iterator       seqVectorPositionIteratorTypedef;
-  //@}
-
   //! @name Constructor/Destructor methods
   //@{
   //! Default constructor.
@@ -96,6 +93,9 @@ public:
   /*! This routine deletes all stored computed vectors */
   void         setPositionValues          (unsigned int posId, const V& vec);
 
+  //! Read-only pointer to the vectorSizeLocal() contiguous values at position \c posId.
+  const double* rawPositionValues         (unsigned int posId) const;
+
   //! Uniformly samples from the CDF from the sub-sequence.
   void         subUniformlySampledCdf     (const V&                             numEvaluationPointsVec,
                                            ArrayOfOneDGrids <V,M>&       cdfGrids,
@@ -214,6 +214,16 @@ public:
                                            unsigned int                         numPos,
                                            V&                                   minVec,
                                            V&                                   maxVec) const;
+  //! One pass statistics of the sub-sequence; see BaseVectorSequence<V,M>::subStatisticsExtra().
+  /*! Blocks of positions are handed to the accumulator straight from the contiguous storage. */
+  void         subStatisticsExtra         (unsigned int                         initialPos,
+                                           unsigned int                         numPos,
+                                           V&                                   meanVec,
+                                           V*                                   sampleVarVec,
+                                           V*                                   popVarVec,
+                                           V*                                   minVec,
+                                           V*                                   maxVec,
+                                           M*                                   covMatrix) const;
   //! Finds the minimum and the maximum values of the unified sequence, considering \c numPos positions starting at position \c initialPos.
   void         unifiedMinMaxExtra         (unsigned int                         initialPos,
                                            unsigned int                         numPos,
@@ -334,11 +344,6 @@ public:
                                            unsigned int                         paramId,
                                            ScalarSequence<double>&       scalarSeq) const;
 
-#ifdef UQ_SEQ_VEC_USES_OPERATOR
-  const V*     operator[]                 (unsigned int posId) const;
-  const V*&    operator[]                 (unsigned int posId);
-#endif
-
 #ifdef UQ_ALSO_COMPUTE_MDFS_WITHOUT_KDE
   void         subUniformlySampledMdf     (const V&                             numEvaluationPointsVec,
                                            ArrayOfOneDGrids <V,M>&       mdfGrids,
@@ -431,8 +436,12 @@ private:
   using BaseVectorSequence<V,M>::m_name;
   using BaseVectorSequence<V,M>::m_fftObj;
 
-  //! Sequence of vectors.
-  std::vector<const V*>          m_seq;
+  //! Number of (local) components of each stored vector.
+  unsigned int                   m_dim;
+
+  //! Sequence of vectors, stored row-major: position \c i occupies
+  //! m_seq[i*m_dim] through m_seq[(i+1)*m_dim-1].
+  std::vector<double>            m_seq;
 
 #ifdef UQ_CODE_HAS_MONITORS
   void         subMeanMonitorAlloc        (unsigned int numberOfMonitorPositions);
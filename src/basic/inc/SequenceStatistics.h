@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_SEQUENCE_STATISTICS_H
+#define UQ_SEQUENCE_STATISTICS_H
+
+#include <vector>
+
+namespace QUESO {
+
+/*!
+ * \file SequenceStatistics.h
+ * \brief One pass accumulation of the statistics of a sequence of vectors.
+ *
+ * \class SequenceStatistics
+ * \brief Accumulates mean, variances, min/max and (optionally) covariances of a sequence of
+ * vectors in a single pass.
+ *
+ * Positions are fed in blocks of consecutive rows, stored row-major (one position after the
+ * other).  Each block is small enough to stay in cache: its own mean and sums of squared (and
+ * cross) deviations are computed from the cached values, and then merged into the running totals
+ * with the pairwise update of Chan, Golub and LeVeque.  The sequence is therefore read from
+ * memory once, whatever statistics are requested, and the result does not suffer from the
+ * cancellation of the naive sum of squares formula.
+ *
+ * Accumulators over disjoint parts of a sequence can be combined with merge(), e.g. when the
+ * parts are processed by different threads.
+ */
+class SequenceStatistics
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Accumulator for vectors of size \c dim; covariances are only kept if \c computeCovariances.
+  SequenceStatistics(unsigned int dim, bool computeCovariances);
+
+  //! Destructor
+  ~SequenceStatistics();
+  //@}
+
+  //! @name Accumulation methods
+  //@{
+  //! Folds in \c numRows positions stored row-major at \c rows.
+  void addBlock(const double* rows, unsigned int numRows);
+
+  //! Folds in the statistics accumulated by \c rhs, which must have the same dimension.
+  void merge(const SequenceStatistics& rhs);
+
+  //! Number of positions that fits a block in a typical L1 cache, for vectors of size \c dim.
+  static unsigned int blockSize(unsigned int dim);
+  //@}
+
+  //! @name Accessor methods
+  //@{
+  //! Number of positions folded in so far.
+  unsigned int numPositions() const;
+
+  //! Mean of component \c i.
+  double mean(unsigned int i) const;
+
+  //! Sample variance (denominator n-1) of component \c i.
+  double sampleVariance(unsigned int i) const;
+
+  //! Population variance (denominator n) of component \c i.
+  double populationVariance(unsigned int i) const;
+
+  //! Minimum of component \c i.
+  double min(unsigned int i) const;
+
+  //! Maximum of component \c i.
+  double max(unsigned int i) const;
+
+  //! Sample covariance (denominator n-1) of components \c i and \c j.
+  double sampleCovariance(unsigned int i, unsigned int j) const;
+  //@}
+
+private:
+  //! Merges a block of \c n positions with mean \c mean and deviation sums \c m2 / \c cross.
+  void mergeBlock(double n,
+                  const std::vector<double>& mean,
+                  const std::vector<double>& m2,
+                  const std::vector<double>& cross,
+                  const std::vector<double>& min,
+                  const std::vector<double>& max);
+
+  unsigned int m_dim;
+  bool m_computeCovariances;
+  unsigned int m_numPositions;
+
+  std::vector<double> m_mean;
+  std::vector<double> m_m2;    // Sums of squared deviations from the mean
+  std::vector<double> m_cross; // Upper triangle, row by row, of the sums of cross deviations
+  std::vector<double> m_min;
+  std::vector<double> m_max;
+
+  // Per block workspace
+  std::vector<double> m_blockMean;
+  std::vector<double> m_blockM2;
+  std::vector<double> m_blockCross;
+  std::vector<double> m_blockMin;
+  std::vector<double> m_blockMax;
+  std::vector<double> m_blockDiff;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_SEQUENCE_STATISTICS_H
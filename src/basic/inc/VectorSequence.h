@@ -30,6 +30,7 @@
 #include <queso/VectorSpace.h>
 #include <queso/BoxSubset.h>
 #include <queso/ScalarSequence.h>
+#include <queso/SequenceStatistics.h>
 #include <queso/SequenceStatisticalOptions.h>
 #include <queso/ArrayOfOneDGrids.h>
 #include <queso/ArrayOfOneDTables.h>
@@ -265,6 +266,19 @@ public:
 						       unsigned int                             numPos,
 						       V&                                       unifiedMinVec,
 						       V&                                       unifiedMaxVec) const = 0;
+  //! Computes several statistics of the sub-sequence in one pass over \c numPos positions starting at position \c initialPos.
+  /*! The mean is always computed; the sample variance, population variance, minimum, maximum
+   * and sample covariance matrix are computed for the outputs that are not NULL.  Positions are
+   * read once, in cache-sized blocks, and folded into a SequenceStatistics accumulator, so asking
+   * for all of them costs about as much as asking for the mean alone. */
+  virtual  void           subStatisticsExtra          (unsigned int                             initialPos,
+						       unsigned int                             numPos,
+						       V&                                       meanVec,
+						       V*                                       sampleVarVec,
+						       V*                                       popVarVec,
+						       V*                                       minVec,
+						       V*                                       maxVec,
+						       M*                                       covMatrix) const;
   //! Calculates the histogram of the sub-sequence. See template specialization.
   /*! The IQR is a robust estimate of the spread of the data, since changes in the upper and
   * lower 25% of the data do not affect it. If there are outliers in the data, then the IQR
@@ -415,6 +429,15 @@ protected:
   /*! This routine deletes all stored computed vectors */
   void           copy                        (const BaseVectorSequence<V,M>&    src);
 
+  //! Copies the statistics accumulated in \c stats to the non NULL outputs of subStatisticsExtra().
+  void           storeStatistics             (const SequenceStatistics&               stats,
+                                              V&                                       meanVec,
+                                              V*                                       sampleVarVec,
+                                              V*                                       popVarVec,
+                                              V*                                       minVec,
+                                              V*                                       maxVec,
+                                              M*                                       covMatrix) const;
+
   //! Extracts the raw data. See template specialization.
   virtual  void           extractRawData              (unsigned int                             initialPos,
                                                        unsigned int                             spacing,
@@ -68,6 +68,7 @@
 #include<queso/TeuchosMatrix.h>
 #include<queso/RngBase.h>
 #include<queso/RngCXX11.h>
+#include<queso/RngPhilox.h>
 #include<queso/LibMeshOperatorBase.h>
 #include<queso/Matrix.h>
 #include<queso/BoostInputOptionsParser.h>
@@ -88,6 +89,9 @@
 #include<queso/VectorSequence.h>
 #include<queso/VectorFunction.h>
 #include<queso/ArrayOfSequences.h>
+#include<queso/AsyncSequenceWriter.h>
+#include<queso/BinaryChainFile.h>
+#include<queso/SequenceStatistics.h>
 #include<queso/SequenceOfVectors.h>
 #include<queso/ScalarSequence.h>
 #include<queso/VectorSet.h>
@@ -101,6 +105,8 @@
 #include<queso/SimulationOutputMesh.h>
 #include<queso/SimulationOutputPoint.h>
 #include<queso/GPMSAOptions.h>
+#include<queso/GPMSAPredictor.h>
+#include<queso/GPMSAStructuredCovariance.h>
 #include<queso/ExperimentalLikelihoodInterface.h>
 #include<queso/ExperimentMetricBase.h>
 #include<queso/ExperimentalLikelihoodWrapper.h>
@@ -147,6 +153,8 @@
 #include<queso/InverseGammaVectorRV.h>
 #include<queso/TransformedScaledCovMatrixTKGroup.h>
 #include<queso/FiniteDistribution.h>
+#include<queso/Resampling.h>
+#include<queso/TemperingExponentSolver.h>
 #include<queso/GenericVectorRealizer.h>
 #include<queso/BetaVectorRealizer.h>
 #include<queso/GenericVectorMdf.h>
@@ -158,6 +166,7 @@
 #include<queso/ScalarCovarianceFunction.h>
 #include<queso/LogNormalJointPdf.h>
 #include<queso/MetropolisHastingsSGOptions.h>
+#include<queso/PopulationMetropolisHastingsSG.h>
 #include<queso/InverseGammaVectorRealizer.h>
 #include<queso/ScalarGaussianRandomField.h>
 #include<queso/JeffreysVectorRV.h>
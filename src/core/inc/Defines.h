@@ -36,6 +36,10 @@
 #define QUESO_HAS_HDF5
 #endif
 
+#ifdef QUESO_HAVE_LAPACKE
+#define QUESO_HAS_LAPACKE
+#endif
+
 #ifdef QUESO_HAVE_TRILINOS
 #define QUESO_HAS_TRILINOS
 #endif
@@ -102,6 +106,7 @@ const int UQ_MATRIX_SVD_FAILED_RC          = -11;
 #define UQ_FILE_EXTENSION_FOR_MATLAB_FORMAT "m"
 #define UQ_FILE_EXTENSION_FOR_TXT_FORMAT    "txt"
 #define UQ_FILE_EXTENSION_FOR_HDF_FORMAT    "h5"
+#define UQ_FILE_EXTENSION_FOR_BIN_FORMAT    "bin"
 
 
 /*! \file Defines.h
@@ -358,8 +358,39 @@ public:
   unsigned int    checkingLevel    () const;
 
   //! Access to the RNG object.
+  /*! This is the stream set by setActiveRngStream(), if any, and the
+   * environment's own generator otherwise. */
   const RngBase* rngObject  () const;
 
+  //! Whether chains should draw from their own RNG streams (option env_rngStreams).
+  bool                  rngStreams () const;
+
+  //! Starts a new solve for the RNG streams.
+  /*! Streams made by later newRngStream() calls are also keyed by the number
+   * of solves started so far, so two solves in one environment draw
+   * different samples while the n-th solve of every run draws the same ones.
+   * Every process of the environment must start the same solves. */
+  void                  nextRngStreamSolve() const;
+
+  //! Whether a stream set by setActiveRngStream() is active.
+  bool                  rngStreamActive() const;
+
+  //! Returns a new generator for the stream keyed by (\c subEnvironmentId, \c chainId, \c threadId).
+  /*! The generator has the type of rngObject() and depends only on env_seed
+   * (not on the rank), on the current solve (see nextRngStreamSolve()) and
+   * on the key, so that whoever creates it, and whenever, it gives the same
+   * samples.  Keys must fit in 16, 32 and 16 bits respectively.  The caller
+   * owns the result; a stream must only be used by one thread at a time. */
+  RngBase*              newRngStream(unsigned int subEnvironmentId,
+                                     unsigned int chainId,
+                                     unsigned int threadId) const;
+
+  //! Makes rngObject() return \c rng, or the environment's own generator again if \c rng is NULL.
+  /*! Everything that samples through the environment (realizers, vector
+   * cwSet*() methods, samplers) then draws from \c rng, which must outlive
+   * its activation. */
+  void                  setActiveRngStream(const RngBase* rng) const;
+
   //! Reset RNG seed.
   void                  resetSeed  (int newSeedOption);
 
@@ -455,6 +486,8 @@ protected:
 
   mutable ScopedPtr<std::ofstream>::Type m_subDisplayFile;
   ScopedPtr<RngBase>::Type m_rngObject;
+  mutable const RngBase* m_activeRngStream;
+  mutable unsigned int m_rngStreamSolve;
   ScopedPtr<BasicPdfsBase>::Type m_basicPdfs;
   struct timeval m_timevalBegin;
   mutable bool m_exceptionalCircumstance;
@@ -462,6 +495,32 @@ protected:
   ScopedPtr<EnvOptionsValues>::Type m_optionsObj;
 };
 
+//*****************************************************
+// Active RNG stream guard
+//*****************************************************
+/*!  \class ActiveRngStreamGuard
+ *  \brief Activates an RNG stream of an environment for the lifetime of the guard.
+ *
+ * The stream that was active before (or none) is restored by the destructor,
+ * also when the guarded code throws. A NULL \c rng leaves the active stream
+ * unchanged.
+ */
+class ActiveRngStreamGuard {
+public:
+  //! Saves the active stream of \c env and activates \c rng, if not NULL.
+  ActiveRngStreamGuard(const BaseEnvironment& env, const RngBase* rng);
+
+  //! Restores the stream that was active on construction.
+ ~ActiveRngStreamGuard();
+
+private:
+  ActiveRngStreamGuard(const ActiveRngStreamGuard&);
+  ActiveRngStreamGuard& operator=(const ActiveRngStreamGuard&);
+
+  const BaseEnvironment& m_env;
+  const RngBase*         m_previousRngStream;
+};
+
 //*****************************************************
 // Empty Environment
 //*****************************************************
@@ -51,6 +51,7 @@
 #define UQ_ENV_CHECKING_LEVEL_ODV           0
 #define UQ_ENV_RNG_TYPE_ODV                 "gsl"
 #define UQ_ENV_SEED_ODV                     0
+#define UQ_ENV_RNG_STREAMS_ODV              0
 #define UQ_ENV_IDENTIFYING_STRING_ODV       ""
 #define UQ_ENV_PLATFORM_NAME_ODV            ""
 #define UQ_ENV_NUM_DEBUG_PARAMS_ODV         0
@@ -154,7 +155,7 @@ public:
   //! Checking level
   unsigned int m_checkingLevel;
 
-  //! Type of the random number generator.
+  //! Type of the random number generator: gsl, boost, cxx11 or philox.
   std::string m_rngType;
 
   //! Seed of the random number generator.
@@ -166,6 +167,19 @@ public:
    */
   int m_seed;
 
+  //! Whether chains draw from their own RNG streams.
+  /*!
+   * If true, each chain of PopulationMetropolisHastingsSG, the chain of a
+   * MetropolisHastingsSG or MonteCarloSG of each subenvironment, and each
+   * linked chain of an MLSampling level (balanced, unbalanced or dynamically
+   * balanced) draws from its own stream (see
+   * BaseEnvironment::newRngStream()), so results no longer depend on the
+   * order in which chains are advanced or on which subenvironment ends up
+   * running them.  MLSampling still draws its level 0 prior samples and its
+   * resampling indexes from the environment's generator.
+   */
+  bool m_rngStreams;
+
   //! Platform name.
   std::string m_platformName;
 
@@ -219,6 +233,9 @@ private:
   //! Input file option name for m_seed
   std::string m_option_seed;
 
+  //! Input file option name for m_rngStreams
+  std::string m_option_rngStreams;
+
   //! Input file option name for m_platformName
   std::string m_option_platformName;
 
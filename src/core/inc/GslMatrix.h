@@ -36,6 +36,7 @@
 
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_permutation.h>
+#include <vector>
 
 namespace QUESO {
 
@@ -96,6 +97,11 @@ public:
 
   //! Stores in \c this the coordinate-wise subtraction of \c this by \c rhs.
   GslMatrix& operator-=(const GslMatrix& rhs);
+
+  //! Stores in \c this the sum of \c this and the rank one matrix \c alpha x x^T (BLAS syr).
+  /*! Both triangles are updated, and each entry gets alpha*(x_i*x_j), exactly what
+   * <tt>*this += alpha*matrixProduct(x,x)</tt> gives, without the two temporary matrices. */
+  void       syr       (double alpha, const GslVector& x);
   //@}
 
 
@@ -176,6 +182,16 @@ public:
   /*! In case \this fails to be symmetric and positive definite, an error will be returned. */
   int               chol                      ();
 
+  //! Rank-one update of a Cholesky factor: \c this holds a lower triangular factor \f$ L \f$ on entry and the factor of \f$ L L^T + x x^T \f$ on exit.
+  /*! Only the lower triangle of \c this is referenced.  The update costs O(n^2), against O(n^3) for a
+   * fresh chol().  Returns UQ_MATRIX_IS_NOT_POS_DEFINITE_RC if \c L has a non-positive diagonal entry. */
+  int               cholUpdate                (const GslVector& x);
+
+  //! Rank-one downdate of a Cholesky factor: \c this holds a lower triangular factor \f$ L \f$ on entry and the factor of \f$ L L^T - x x^T \f$ on exit.
+  /*! Only the lower triangle of \c this is referenced.  Returns UQ_MATRIX_IS_NOT_POS_DEFINITE_RC if the
+   * downdated matrix is not positive definite, in which case the contents of \c this are unusable. */
+  int               cholDowndate              (const GslVector& x);
+
 //! Checks for the dimension of \c this matrix, \c matU, \c VecS and \c matVt, and calls the protected routine \c internalSvd to compute the singular values of \c this.
   int               svd                       (GslMatrix& matU, GslVector& vecS, GslMatrix& matVt) const;
 
@@ -211,6 +227,34 @@ public:
    */
   void cholSolve(const GslVector & rhs, GslVector & sol) const;
 
+  //! Calculates ln(det(A)) = 2 sum ln(L_ii) from the cached Cholesky factor \c L of \c this matrix.
+  /*!
+   * The factorisation is the one cholSolve() caches, so calling both costs
+   * a single factorisation.  Unlike lnDeterminant() no LU decomposition is
+   * computed and the determinant itself is never formed, so the result does
+   * not under- or overflow for large matrices.  The matrix must be symmetric
+   * and positive definite.
+   */
+  double cholLnDeterminant() const;
+
+  //! Solves L x = b, with \c L the cached Cholesky factor of \c this matrix (x=sol, b=rhs).
+  /*!
+   * This is half of cholSolve(): for A = L L^T, the quadratic form
+   * b^T A^{-1} c equals (L^{-1} b)^T (L^{-1} c), so several forms sharing
+   * one factorisation only need one triangular solve per vector.  The
+   * matrix must be symmetric and positive definite; \c sol must be
+   * pre-sized.
+   */
+  void cholForwardSolve(const GslVector & rhs, GslVector & sol) const;
+
+  //! Solves L X = B for all columns of B at once, with \c L the cached Cholesky factor of \c this matrix (X=sol, B=rhs).
+  /*!
+   * The multiple right hand side version of cholForwardSolve(), done with a
+   * single level 3 BLAS triangular solve.  \c sol must be pre-sized to the
+   * size of \c rhs.
+   */
+  void cholForwardSolve(const GslMatrix & rhs, GslMatrix & sol) const;
+
   //! This function multiplies \c this matrix by vector \c x and returns the resulting vector.
   GslVector  multiply                  (const GslVector& x) const;
 
@@ -218,6 +262,23 @@ public:
   //the preallocated vector \c y.
   void       multiply                  (const GslVector& x, GslVector& y) const;
 
+  //! Computes y = L x, with \c L the lower triangle (diagonal included) of \c this square matrix.
+  /*! The strict upper triangle is not referenced, so this costs half of multiply().  \c y must be
+   * pre-sized and must not be \c x. */
+  void       lowerTriangularMultiply   (const GslVector& x, GslVector& y) const;
+
+  //! Computes y = mu + L z in one pass, with \c L the lower triangle of \c this square matrix.
+  /*! This is how a Gaussian sample is drawn from a Cholesky factor.  \c y may be \c mu but not \c z. */
+  void       lowerTriangularMultiplyAdd(const GslVector& mu, const GslVector& z, GslVector& y) const;
+
+  //! Solves L x = b by forward substitution, with \c L the lower triangle of \c this square matrix.
+  /*! The strict upper triangle is not referenced.  \c x must be pre-sized and may be \c b. */
+  void       lowerTriangularSolve      (const GslVector& b, GslVector& x) const;
+
+  //! Computes y = alpha A x + beta y (BLAS gemv), with \c A \c this matrix.
+  /*! \c y must be pre-sized and must not be \c x. */
+  void       gemv                      (double alpha, const GslVector& x, double beta, GslVector& y) const;
+
   //! This function multiplies \c this matrix by matrix \c X and returns the resulting matrix.
   GslMatrix  multiply                  (const GslMatrix& X) const;
 
@@ -271,6 +332,8 @@ GslVector& x) internally.*/
   void              setRow                    (const unsigned int row_num, const GslVector& row);
 
   //! This function computes the eigenvalues of a real symmetric matrix.
+  /*! When \c eigenVectors is given, the eigenvalues are in ascending order and the
+   * eigenvectors are its columns.  With \c --with-lapacke this is LAPACK's syevd. */
   void              eigen                     (GslVector& eigenValues, GslMatrix* eigenVectors) const;
 
   //! This function finds largest eigenvalue, namely \c eigenValue, of \c this matrix and its corresponding eigenvector, namely \c eigenVector.
@@ -385,6 +448,12 @@ GslVector& x) internally.*/
 
   void              mpiSum                    (const MpiComm& comm, GslMatrix& M_global) const;
 
+  //! Reduces this matrix over \c opComm with \c mpiOperation into \c resultMat, in one collective.
+  void              mpiAllReduce              (RawType_MPI_Op mpiOperation, const MpiComm& opComm, GslMatrix& resultMat) const;
+
+  //! Same as mpiAllReduce() for a symmetric matrix: only its packed upper triangle is communicated.
+  void              mpiAllReduceSymmetric     (RawType_MPI_Op mpiOperation, const MpiComm& opComm, GslMatrix& resultMat) const;
+
   void              matlabLinearInterpExtrap  (const GslVector& x1Vec, const GslMatrix& y1Mat, const GslVector& x2Vec);
   //@}
 
@@ -423,6 +492,15 @@ private:
   //! This function factorizes the M-by-N matrix A into the singular value decomposition A = U S V^T for M >= N. On output the matrix A is replaced by U.
   int               internalSvd               () const;
 
+  //! Shared implementation of cholUpdate() (\c sign = 1) and cholDowndate() (\c sign = -1).
+  int               internalCholRankOne       (const GslVector& x, double sign);
+
+  //! Shared implementation of lowerTriangularMultiply() (\c mu = NULL) and lowerTriangularMultiplyAdd().
+  void              internalLowerTriangularMultiply(const GslVector* mu, const GslVector& z, GslVector& y) const;
+
+  //! Computes and caches the Cholesky factor used by cholSolve() and cholLnDeterminant(), unless already cached.
+  void              internalCachedChol        () const;
+
   //! GSL matrix, also referred to as \c this matrix.
           gsl_matrix*       m_mat;
 
@@ -432,6 +510,9 @@ private:
   //! GSL matrix for the LL^T decomposition of m_mat.
   mutable SharedPtr<gsl_matrix>::Type m_chol;
 
+  //! Workspace of cholUpdate() and cholDowndate(), sized on first use.
+  std::vector<double> m_cholRankOneWork;
+
   //! Inverse matrix of \c this.
   mutable GslMatrix* m_inverse;
 
@@ -95,6 +95,10 @@ public:
 
   //! Stores in \c this the coordinate-wise subtraction of \c this by rhs.
   GslVector& operator-=(const GslVector& rhs);
+
+  //! Stores in \c this the sum of \c this and \c alpha times \c x (BLAS axpy).
+  /*! Unlike <tt>*this += alpha*x</tt>, no temporary vector is allocated. */
+  void       axpy      (double alpha, const GslVector& x);
   //@}
 
   //! @name Accessor methods.
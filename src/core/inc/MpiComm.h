@@ -46,6 +46,7 @@ typedef MPI_Op       RawType_MPI_Op ;
 typedef MPI_Status   RawType_MPI_Status ;
 #define RawValue_MPI_COMM_SELF  MPI_COMM_SELF
 #define RawValue_MPI_ANY_SOURCE MPI_ANY_SOURCE
+#define RawValue_MPI_ANY_TAG    MPI_ANY_TAG
 #define RawValue_MPI_CHAR       MPI_CHAR
 #define RawValue_MPI_INT        MPI_INT
 #define RawValue_MPI_DOUBLE     MPI_DOUBLE
@@ -62,6 +63,7 @@ typedef int RawType_MPI_Op;
 typedef int RawType_MPI_Status;
 #define RawValue_MPI_COMM_SELF   0
 #define RawValue_MPI_ANY_SOURCE -1
+#define RawValue_MPI_ANY_TAG    -1
 #define RawValue_MPI_CHAR        0
 #define RawValue_MPI_INT         1
 #define RawValue_MPI_DOUBLE      2
@@ -370,6 +372,22 @@ public:
    * \param tag message tag*/
   void               Send     (void *buf, int count, RawType_MPI_Datatype datatype, int dest, int tag,
                                const char* whereMsg, const char* whatMsg) const;
+
+  //! Nonblocking test for a message from another process.
+  /*!\param source rank of source, or RawValue_MPI_ANY_SOURCE
+   * \param tag message tag
+   * \param status (output) status object
+   * Returns true if a matching message is ready to be received. */
+  bool               Iprobe   (int source, int tag, RawType_MPI_Status *status,
+                               const char* whereMsg, const char* whatMsg) const;
+
+  //! Blocking test for a message from another process.
+  /*!\param source rank of source, or RawValue_MPI_ANY_SOURCE
+   * \param tag message tag, or RawValue_MPI_ANY_TAG
+   * \param status (output) status object
+   * Returns once a matching message is ready to be received; needs more than one process. */
+  void               Probe    (int source, int tag, RawType_MPI_Status *status,
+                               const char* whereMsg, const char* whatMsg) const;
  //@}
 
 //! @name Miscellaneous Methods
@@ -27,6 +27,7 @@
 
 #include <queso/Defines.h>
 #include <iostream>
+#include <stdint.h>
 
 namespace QUESO {
 
@@ -76,8 +77,47 @@ public:
   //! Samples a value from a Gamma distribution.
   virtual double gammaSample   (double a, double b)        const = 0;
 
+  //! Fills \c samples[0], ..., \c samples[n-1] with samples from a uniform distribution.
+  /*! The default implementation calls uniformSample() \c n times, so it
+   * gives exactly the same stream of samples.  Generators that can fill a
+   * block faster than one virtual call per sample override it. */
+  virtual void   uniformSamples (double * samples, unsigned int n)                const;
+
+  //! Fills \c samples[0], ..., \c samples[n-1] with samples from a Gaussian distribution with standard deviation \c stdDev.
+  /*! The default implementation calls gaussianSample() \c n times, so it
+   * gives exactly the same stream of samples. */
+  virtual void   gaussianSamples(double * samples, unsigned int n, double stdDev) const;
+
+  //@}
+
+  //! @name State methods
+  //@{
+  //! Writes the full internal state of the generator to \c os.
+  /*! Reading it back with readState() into a generator of the same type makes
+   * it continue with exactly the same stream of samples.  Used by the
+   * checkpoint/restart of MetropolisHastingsSG. */
+  virtual void   writeState    (std::ostream& os) const = 0;
+
+  //! Restores an internal state previously saved with writeState().
+  /*! Like the sampling methods, this is const: the generator state is not
+   * part of the logical state of the object. */
+  virtual void   readState     (std::istream& is)       const = 0;
+  //@}
+
+  //! @name Stream methods
+  //@{
+  //! Returns a new generator of the same type for stream \c streamId of \c seed.
+  /*! The new generator depends only on \c seed and \c streamId, not on the
+   * state of \c this, and the caller owns it.  Counter based generators give
+   * disjoint streams; the others are seeded from a hash of \c seed and
+   * \c streamId.  The default implementation throws. */
+  virtual RngBase* newStream     (int seed, uint64_t streamId) const;
+
+  //! A positive seed mixing \c seed and \c streamId (SplitMix64), for generators without native streams.
+  static  int      streamSeed    (int seed, uint64_t streamId);
   //@}
 protected:
+
   //! Seed.
           int m_seed;
 
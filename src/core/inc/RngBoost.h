@@ -68,7 +68,7 @@ public:
   /*! This function samples from continuous uniform distribution on the range [0,1). It is
    * possible to scale this distribution so the support is defined by the two parameters,
    * a and b, which are its minimum and maximum values. Support: -infinity < a < x< b< infinity.
-   * Uses boost::uniform_01<boost::mt19937> zeroone(m_rng).*/
+   * Uses boost::uniform_01<double> on m_rng.*/
   double   uniformSample ()                          const;
 
 
@@ -99,6 +99,15 @@ public:
    * boost::math::gamma_distribution<double>  gamma_dist(a,b). Support (domain): [0,infinity).*/
   double   gammaSample   (double a, double b)        const;
 
+  //! Writes the generator state to \c os.
+  void     writeState    (std::ostream& os)          const;
+
+  //! Restores a generator state written by writeState().
+  void     readState     (std::istream& is)          const;
+
+  //! Returns a new RngBoost seeded from a hash of \c seed and \c streamId.
+  RngBase* newStream     (int seed, uint64_t streamId) const;
+
 private:
   //! Default Constructor: it should not be used.
   RngBoost();
@@ -109,7 +118,7 @@ private:
    * approximately 625*sizeof(uint32_t) of memory, has relatively high speed (93% of the
    * fastest available in Boost library), and provides good uniform distribution in up to
    * 623 dimensions. */
-  boost::mt19937 m_rng; // it cannot be static, as it is not initialized yet
+  mutable boost::mt19937 m_rng; // it cannot be static, as it is not initialized yet
 };
 
 }  // End namespace QUESO
@@ -109,6 +109,15 @@ public:
    */
   double gammaSample(double a, double b) const;
 
+  //! Writes the engine state to \c os.
+  void writeState(std::ostream& os) const;
+
+  //! Restores an engine state written by writeState().
+  void readState(std::istream& is) const;
+
+  //! Returns a new RngCXX11 seeded from a hash of \c seed and \c streamId.
+  RngBase* newStream(int seed, uint64_t streamId) const;
+
 private:
   //! Default Constructor: it should not be used.
   RngCXX11();
@@ -101,6 +101,15 @@ public:
    * (domain): [0,infinity).*/
   double   gammaSample   (double a, double b)        const;
 
+  //! Writes the generator state to \c os.
+  void     writeState    (std::ostream& os)          const;
+
+  //! Restores a generator state written by writeState().
+  void     readState     (std::istream& is)          const;
+
+  //! Returns a new RngGsl seeded from a hash of \c seed and \c streamId.
+  RngBase* newStream     (int seed, uint64_t streamId) const;
+
   //! GSL random number generator.
   const gsl_rng* rng           () const;
 
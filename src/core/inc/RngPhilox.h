@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_RNG_PHILOX_H
+#define UQ_RNG_PHILOX_H
+
+#include <queso/RngBase.h>
+#include <stdint.h>
+
+namespace QUESO {
+
+/*! \file RngPhilox.h
+    \brief Counter based random number generation class.
+*/
+
+/*! \class RngPhilox
+    \brief Class for random number generation with the Philox4x32-10 counter based generator.
+
+    Philox (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11)
+    computes the i-th block of random bits as a keyed bijection of the
+    counter i, so the whole state is the key (the seed) and the counter.  This
+    makes filling large blocks of samples cheap: uniformSamples() and
+    gaussianSamples() generate whole blocks in straight loops, without one
+    virtual call per sample.  Gaussian samples come from the Box-Muller
+    transform.
+
+    Repeated calls of the scalar sampling methods give exactly the same
+    stream of samples as the bulk ones.
+
+    The upper half of the counter holds a stream id, so generators with the
+    same seed and different stream ids (see newStream()) never share a block.
+*/
+
+class RngPhilox : public RngBase
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor with seed, for stream \c streamId of that seed.
+  RngPhilox(int seed, int worldRank, uint64_t streamId = 0);
+
+  //! Destructor
+  ~RngPhilox();
+  //@}
+
+  //! @name Sampling methods
+  //@{
+  //! Resets the seed with value \c newSeed, and the counter to zero.
+  void   resetSeed      (int newSeed);
+
+  //! Samples a value from a uniform distribution. Support: (0,1).
+  double uniformSample  () const;
+
+  //! Samples a value from a Gaussian distribution with standard deviation given by \c stdDev.
+  double gaussianSample (double stdDev) const;
+
+  //! Samples a value from a Beta distribution, as X/(X+Y) with X, Y Gamma distributed.
+  double betaSample     (double alpha, double beta) const;
+
+  //! Samples a value from a Gamma distribution with shape \c a and scale \c b (Marsaglia and Tsang).
+  double gammaSample    (double a, double b) const;
+
+  //! Fills \c samples[0], ..., \c samples[n-1] with uniform samples, a block at a time.
+  void   uniformSamples (double * samples, unsigned int n) const;
+
+  //! Fills \c samples[0], ..., \c samples[n-1] with Gaussian samples, two per Box-Muller transform.
+  void   gaussianSamples(double * samples, unsigned int n, double stdDev) const;
+  //@}
+
+  //! @name State methods
+  //@{
+  //! Writes key, counter and buffered samples to \c os.
+  void   writeState     (std::ostream& os) const;
+
+  //! Restores a state written by writeState().
+  void   readState      (std::istream& is) const;
+  //@}
+
+  //! Returns a new RngPhilox for stream \c streamId of \c seed.
+  RngBase* newStream    (int seed, uint64_t streamId) const;
+
+  //! The Philox4x32-10 bijection: \c out is the block of random bits for \c counter under \c key.
+  static void philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]);
+
+private:
+  //! Default Constructor: it should not be used.
+  RngPhilox();
+
+  //! Sets the key from m_seed and rewinds the counter.
+  void privateResetState();
+
+  //! Converts the next block into two uniform samples in (0,1), and advances the counter.
+  void nextUniformPair(double & u0, double & u1) const;
+
+  //! Key, set from the seed.  Mutable only so that readState() can restore it.
+  mutable uint32_t m_key[2];
+
+  //! Stream id, the upper half of the counter.  Mutable only so that readState() can restore it.
+  mutable uint64_t m_stream;
+
+  //! Index of the next block within the stream.
+  mutable uint64_t m_counter;
+
+  //! Second uniform sample of the last block, if not consumed yet.
+  mutable double m_uniformBuffer;
+  mutable bool   m_hasUniformBuffer;
+
+  //! Second (unit variance) Gaussian sample of the last Box-Muller transform, if not consumed yet.
+  mutable double m_gaussianBuffer;
+  mutable bool   m_hasGaussianBuffer;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_RNG_PHILOX_H
@@ -96,6 +96,9 @@ public:
   TeuchosMatrix& operator+=(const TeuchosMatrix& rhs);
   //! Stores in \c this the coordinate-wise subtraction of \c this by \c rhs.
   TeuchosMatrix& operator-=(const TeuchosMatrix& rhs);
+
+  //! Stores in \c this the sum of \c this and the rank one matrix \c alpha x x^T (BLAS syr), without temporaries.
+  void           syr       (double alpha, const TeuchosVector& x);
   //@}
 
     //! @name Accessor methods
@@ -188,6 +191,22 @@ public:
   //! This function multiplies \c this matrix by vector \c x and returns a vector.
   TeuchosVector  multiply                  (const TeuchosVector& x) const;
 
+  //! Computes y = alpha A x + beta y (BLAS gemv), with \c A \c this matrix.
+  /*! \c y must be pre-sized and must not be \c x. */
+  void           gemv                      (double alpha, const TeuchosVector& x, double beta, TeuchosVector& y) const;
+
+  //! Computes y = L x, with \c L the lower triangle (diagonal included) of \c this square matrix.
+  /*! The strict upper triangle is not referenced.  \c y must be pre-sized and must not be \c x. */
+  void           lowerTriangularMultiply   (const TeuchosVector& x, TeuchosVector& y) const;
+
+  //! Computes y = mu + L z in one pass, with \c L the lower triangle of \c this square matrix.
+  /*! \c y may be \c mu but not \c z. */
+  void           lowerTriangularMultiplyAdd(const TeuchosVector& mu, const TeuchosVector& z, TeuchosVector& y) const;
+
+  //! Solves L x = b by forward substitution, with \c L the lower triangle of \c this square matrix.
+  /*! The strict upper triangle is not referenced.  \c x must be pre-sized and may be \c b. */
+  void           lowerTriangularSolve      (const TeuchosVector& b, TeuchosVector& x) const;
+
   //! This function calculates the inverse of \c this matrix, multiplies it with vector \c b and stores the result in vector \c x.
   /*! It checks for a previous LU decomposition of \c this matrix and does not recompute it
    if private attribute m_LU != NULL .*/
@@ -305,6 +324,12 @@ TeuchosVector& x) internally.*/
 
   void              mpiSum                 (const MpiComm& comm, TeuchosMatrix& M_global) const;
 
+  //! Reduces this matrix over \c opComm with \c mpiOperation into \c resultMat, in one collective.
+  void              mpiAllReduce           (RawType_MPI_Op mpiOperation, const MpiComm& opComm, TeuchosMatrix& resultMat) const;
+
+  //! Same as mpiAllReduce() for a symmetric matrix: only its packed upper triangle is communicated.
+  void              mpiAllReduceSymmetric  (RawType_MPI_Op mpiOperation, const MpiComm& opComm, TeuchosMatrix& resultMat) const;
+
   void              matlabLinearInterpExtrap  (const TeuchosVector& x1Vec, const TeuchosMatrix& y1Mat, const TeuchosVector& x2Vec);
   //@}
 
@@ -348,6 +373,9 @@ private:
    * of U and V are the left and right singular vectors of A. Note that the routine returns V**T, not V. */
   int               internalSvd               () const;
 
+  //! Shared implementation of lowerTriangularMultiply() (\c mu = NULL) and lowerTriangularMultiplyAdd().
+  void              internalLowerTriangularMultiply(const TeuchosVector* mu, const TeuchosVector& z, TeuchosVector& y) const;
+
   //! Teuchos matrix, also referred to as \c this matrix.
   Teuchos::SerialDenseMatrix<int,double> m_mat;
 
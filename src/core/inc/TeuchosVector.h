@@ -104,6 +104,9 @@ public:
 
    //! Stores in \c this vector the coordinate-wise subtraction of \c this and \c rhs.
   TeuchosVector& operator-=(const TeuchosVector& rhs);
+
+  //! Stores in \c this vector the sum of \c this and \c alpha times \c x (BLAS axpy), without a temporary.
+  void           axpy      (double alpha, const TeuchosVector& x);
   //@}
 
     //! @name Accessor methods.
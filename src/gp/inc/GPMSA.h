@@ -37,6 +37,7 @@
 #include <queso/BetaVectorRV.h>
 #include <queso/UniformVectorRV.h>
 #include <queso/GPMSAOptions.h>
+#include <queso/GPMSAStructuredCovariance.h>
 #include <queso/ScopedPtr.h>
 #include <queso/SharedPtr.h>
 
@@ -84,12 +85,47 @@ public:
                          M * hessianMatrix,
                          V * hessianEffect) const;
 
+  //! Returns lnValue() and its analytic gradient, so gradient based
+  //! samplers and optimizers don't fall back to finite differences
+  virtual double lnValue(const V & domainVector, V & gradVector) const;
+
   virtual double actualValue(const V & domainVector,
                              const V * domainDirection,
                              V * gradVector,
                              M * hessianMatrix,
                              V * hessianEffect) const;
 
+  //! True if lnValue() without a gradient factors the covariance block by
+  //! block, i.e. m_opts.m_structuredCovariance is set, the outputs are
+  //! vectors and their covariance has the block structure it needs
+  bool structuredCovarianceUsed() const;
+
+  //! True if structuredCovarianceUsed() and the simulation design is a full
+  //! grid, so the simulation blocks are Kronecker products
+  bool kroneckerSimulationBlocksUsed() const;
+
+  //! Fills \c covMatrix with the covariance of the data residual at \c domainVector
+  /*!
+   * This is the dense "Sigma_D" (scalar case) or "Sigma_zhat" (vector case)
+   * matrix lnValue() factors; \c covMatrix must be residual-sized and zero.
+   */
+  void fillCovarianceMatrix(const V & domainVector, M & covMatrix) const;
+
+  //! Fills the covariances of the data residual with the latent weights at a new point
+  /*!
+   * The latent weights at (\c scenario, \c parameter) are the emulator
+   * weights of each basis, then the discrepancy weights of each discrepancy
+   * basis.  Column l of \c crossCovariance holds their covariance with the
+   * data residual, and \c priorVariances[l] their prior variance; they are
+   * a priori uncorrelated with each other.  Parameters are physical, as in
+   * \c domainVector.
+   */
+  void fillPredictionCovariance(const V & domainVector,
+                                const V & scenario,
+                                const V & parameter,
+                                M & crossCovariance,
+                                std::vector<double> & priorVariances) const;
+
   const VectorSpace<V, M> & m_scenarioSpace;
   const VectorSpace<V, M> & m_parameterSpace;
   const VectorSpace<V, M> & m_simulationOutputSpace;
@@ -147,8 +183,66 @@ public:
   using BaseScalarFunction<V, M>::lnValue;
 
 private:
+  // True if domainVector[start, start+size) equals cachedValues;
+  // otherwise stores those entries in cachedValues and returns false
+  bool sameCachedValues(const V & domainVector,
+                        unsigned int start,
+                        unsigned int size,
+                        std::vector<double> & cachedValues) const;
+
+  // Product of rho^(4 (x1-x2)^2) over the normalized scenario or
+  // uncertain parameter components, rho read from domainVector[start...]
+  double scenarioCorrelation(const V & domainVector,
+                             unsigned int start,
+                             const V & scenario1,
+                             const V & scenario2) const;
+  double parameterCorrelation(const V & domainVector,
+                              unsigned int start,
+                              const V & parameter1,
+                              const V & parameter2) const;
+
+  // True if the vector output covariance has the block structure
+  // GPMSAStructuredCovariance needs; also detects gridded simulation
+  // designs.  Checked once, on the first call.
+  bool structuredCovarianceApplies() const;
+
+  // lnValue() computed with m_structuredCovariance instead of one dense
+  // covariance matrix
+  double structuredLnValue(const V & domainVector) const;
+
+  // Gradient of lnValue() with respect to all of domainVector, given the
+  // (factored) covariance matrix and sol = covMatrix^-1 residual
+  void lnValueGradient(const V & domainVector,
+                       const M & covMatrix,
+                       const V & sol,
+                       V & gradVector) const;
 
   unsigned int m_numExperimentOutputs;
+
+  // Correlation blocks kept between lnValue() calls when
+  // m_opts.m_cacheCovarianceBlocks is set, each valid for the
+  // correlation strengths stored next to it once filled
+  mutable std::vector<double> m_cachedEmulatorCorrStrengths;
+  mutable std::vector<double> m_cachedSimulationCorrelations;
+  mutable std::vector<double> m_cachedDiscrepancyCorrStrengths;
+  mutable std::vector<double> m_cachedDiscrepancyCorrelations;
+  mutable bool m_cachedCorrelationsFilled;
+
+  // State of the m_opts.m_structuredCovariance path
+  mutable bool m_structuredChecked;
+  mutable bool m_structuredApplies;
+  mutable typename ScopedPtr<GPMSAStructuredCovariance<V, M> >::Type m_structuredCovariance;
+
+  // Simulation j sits at m_gridScenarios[m_gridScenarioIndex[j]] and
+  // m_gridParameters[m_gridParameterIndex[j]]; empty unless the
+  // simulation design is a full grid
+  mutable std::vector<typename SharedPtr<V>::Type> m_gridScenarios;
+  mutable std::vector<typename SharedPtr<V>::Type> m_gridParameters;
+  mutable std::vector<unsigned int> m_gridScenarioIndex;
+  mutable std::vector<unsigned int> m_gridParameterIndex;
+
+  // c_b when the basis b block of KT_K_inv is c_b * I; empty otherwise
+  mutable std::vector<double> m_truncationDiagonal;
 };
 
 template <class V = GslVector, class M = GslMatrix>
@@ -82,6 +82,22 @@ public:
   //  simulation output.
   int m_maxEmulatorBasisVectors;
 
+  //! How the emulator basis is found.  "eigen" (the default)
+  //  diagonalises the n_out x n_out matrix S^T S of the centered
+  //  simulation outputs S; "thin_svd" diagonalises the m x m matrix
+  //  S S^T instead; "randomized" projects S onto a random subspace of
+  //  m_maxEmulatorBasisVectors + m_emulatorBasisOversampling
+  //  dimensions first, and needs m_maxEmulatorBasisVectors to be set.
+  std::string m_emulatorBasisMethod;
+
+  //! The number of extra random directions sampled by the
+  //  "randomized" emulator basis
+  int m_emulatorBasisOversampling;
+
+  //! The number of power iterations used by the "randomized" emulator
+  //  basis to sharpen its subspace
+  int m_emulatorBasisPowerIterations;
+
   //! The minimum fraction of the variance in simulation output to
   //  capture with the emulator basis.  By default this is 1.0, i.e.
   //  100%, in which case there will be one basis vector for each
@@ -218,6 +234,11 @@ public:
   double normalized_output_variable(unsigned int i,
                                     double output_data) const;
 
+  //! Calculate a physical value from a normalized value for the
+  //  output variable at vector index i.
+  double denormalized_output(unsigned int i,
+                             double normalized_data) const;
+
   //! Returns the scale, in physical units, corresponding to a single
   //  nondimensionalized unit for the output at vector index i.
   double output_scale(unsigned int i) const;
@@ -284,6 +305,16 @@ public:
   //! The ridge to add to (B^T*W_y*B)^-1 before using it
   double m_observationalCovarianceRidge;
 
+  //! Whether the likelihood reuses the simulation/simulation emulator
+  //  correlations and the discrepancy correlations from the previous
+  //  call when their correlation strengths did not change
+  bool m_cacheCovarianceBlocks;
+
+  //! Whether the vector output likelihood factors the covariance block
+  //  by block (and as a Kronecker product for gridded simulation
+  //  designs) instead of as one dense matrix
+  bool m_structuredCovariance;
+
   //! The distance between gaussian discrepancy kernels, on each
   //  provided simulation mesh, in each direction.
   std::vector<double> m_gaussianDiscrepancyDistanceX,
@@ -369,6 +400,9 @@ private:
 
   std::string m_option_help;
   std::string m_option_maxEmulatorBasisVectors;
+  std::string m_option_emulatorBasisMethod;
+  std::string m_option_emulatorBasisOversampling;
+  std::string m_option_emulatorBasisPowerIterations;
   std::string m_option_truncationErrorPrecisionShape;
   std::string m_option_truncationErrorPrecisionScale;
   std::string m_option_emulatorBasisVarianceToCapture;
@@ -387,6 +421,8 @@ private:
   std::string m_option_emulatorDataPrecisionScale;
   std::string m_option_observationalPrecisionRidge;
   std::string m_option_observationalCovarianceRidge;
+  std::string m_option_cacheCovarianceBlocks;
+  std::string m_option_structuredCovariance;
 
   std::string m_option_autoscaleMinMaxAll;
   std::string m_option_autoscaleMeanVarAll;
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_GPMSA_PREDICTOR_H
+#define UQ_GPMSA_PREDICTOR_H
+
+#include <vector>
+
+#include <queso/GPMSA.h>
+#include <queso/ScopedPtr.h>
+#include <queso/SharedPtr.h>
+#include <queso/VectorSequence.h>
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*!
+ * \file GPMSAPredictor.h
+ * \brief Posterior predictions of a calibrated GPMSA model
+ *
+ * \class GPMSAPredictor
+ * \brief Posterior predictions of a calibrated GPMSA model
+ *
+ * For one posterior sample of the calibration parameters and
+ * hyperparameters, setSample() factors the data covariance once, as
+ * L L^T.  predict() then conditions the emulator and discrepancy weights
+ * at each new (scenario, parameter) point on the data: with c the
+ * covariance between the data residual r and one weight,
+ *
+ *   mean = (L^{-1} c)^T (L^{-1} r),  variance = prior - |L^{-1} c|^2,
+ *
+ * so every prediction point only costs forward triangular solves.
+ * Means and variances are returned in physical output units, for the
+ * emulator plus discrepancy output.
+ *
+ * predictFromChain() averages over the samples of a chain; each
+ * subenvironment works on its own chain and the results are combined
+ * over inter0Comm().
+ */
+
+template <class V = GslVector, class M = GslMatrix>
+class GPMSAPredictor
+{
+public:
+  //! \c factory must have all its simulations and experiments added
+  GPMSAPredictor(const GPMSAFactory<V, M> & factory);
+
+  ~GPMSAPredictor();
+
+  //! Factors the data covariance at the posterior sample \c domainVector
+  void setSample(const V & domainVector);
+
+  //! Predictive means and variances at the current sample
+  /*!
+   * If \c parameters is empty, every point uses the calibration
+   * parameters of the current sample.  Scenarios and parameters are in
+   * physical units; \c means and \c variances get one simulation output
+   * sized vector per point.
+   */
+  void predict(const std::vector<typename SharedPtr<V>::Type> & scenarios,
+               const std::vector<typename SharedPtr<V>::Type> & parameters,
+               std::vector<typename SharedPtr<V>::Type> & means,
+               std::vector<typename SharedPtr<V>::Type> & variances);
+
+  //! Predictive means and variances averaged over every \c stride-th position of \c chain
+  /*!
+   * The variances include the spread of the per-sample means.  Collective
+   * over all processes.
+   */
+  void predictFromChain(const BaseVectorSequence<V, M> & chain,
+                        unsigned int stride,
+                        const std::vector<typename SharedPtr<V>::Type> & scenarios,
+                        const std::vector<typename SharedPtr<V>::Type> & parameters,
+                        std::vector<typename SharedPtr<V>::Type> & means,
+                        std::vector<typename SharedPtr<V>::Type> & variances);
+
+private:
+  const GPMSAFactory<V, M> & m_factory;
+  const GPMSAEmulator<V, M> & m_emulator;
+
+  Map m_residualMap;
+  Map m_latentMap;
+
+  //! Normalized output of each latent weight: emulator bases, then
+  //  discrepancy bases
+  std::vector<std::vector<double> > m_latentBases;
+
+  typename ScopedPtr<V>::Type m_domainVector;
+  typename ScopedPtr<M>::Type m_covMatrix;
+
+  //! L^{-1} residual for the current sample
+  typename ScopedPtr<V>::Type m_whitenedResidual;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_GPMSA_PREDICTOR_H
@@ -0,0 +1,140 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_GPMSA_STRUCTURED_COVARIANCE_H
+#define UQ_GPMSA_STRUCTURED_COVARIANCE_H
+
+#include <vector>
+
+#include <queso/Environment.h>
+#include <queso/Map.h>
+#include <queso/SharedPtr.h>
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*!
+ * \file GPMSAStructuredCovariance.h
+ * \brief Block structured factorisation of the vector output GPMSA covariance
+ *
+ * \class GPMSAStructuredCovariance
+ * \brief Block structured factorisation of the vector output GPMSA covariance
+ *
+ * The covariance is ordered as [x; w_0; ...; w_{p-1}].  The experiment part
+ * x (discrepancy and experiment emulator weights) is small and dense.  Each
+ * w_b holds the simulation emulator weights of basis b, and the w_b are
+ * uncorrelated with each other.  The block between x and w_b is nonzero
+ * only in the rows of x holding the experiment weights of the same basis.
+ *
+ * The log determinant and the quadratic form of a residual then follow from
+ * one factorisation per simulation block and one of the Schur complement of
+ * all of them, which is the size of x.  That is p factorisations of size m
+ * instead of one of size p*m.
+ *
+ * When the simulation design is a full grid of scenarios times parameters,
+ * the simulation correlation is a Kronecker product, and
+ * setKroneckerSimulationCorrelation() replaces the simulation blocks with
+ * eigendecompositions of the two (much smaller) factors.
+ */
+
+template <class V = GslVector, class M = GslMatrix>
+class GPMSAStructuredCovariance
+{
+public:
+  //! Sets up the blocks; crossRowOffsets[b] is the first row of x coupled to w_b
+  GPMSAStructuredCovariance(const BaseEnvironment & env,
+                            const MpiComm & comm,
+                            unsigned int numExperimentRows,
+                            unsigned int numSimulations,
+                            unsigned int numCrossRows,
+                            const std::vector<unsigned int> & crossRowOffsets);
+
+  ~GPMSAStructuredCovariance();
+
+  //! The dense x/x block; zeroed by the caller before filling
+  M & experimentBlock();
+
+  //! The numCrossRows x numSimulations block between x and w_basis
+  M & crossBlock(unsigned int basis);
+
+  //! The dense w_basis/w_basis block, used unless a Kronecker correlation is set
+  M & simulationBlock(unsigned int basis);
+
+  //! Use w_basis/w_basis = scale[basis] * (Rs kron Rp) + shift[basis] * I
+  /*!
+   * Simulation j sits at scenario scenarioIndex[j] of \c scenarioCorrelation
+   * and parameter parameterIndex[j] of \c parameterCorrelation.
+   */
+  void setKroneckerSimulationCorrelation(const M & scenarioCorrelation,
+                                         const M & parameterCorrelation,
+                                         const std::vector<unsigned int> & scenarioIndex,
+                                         const std::vector<unsigned int> & parameterIndex,
+                                         const std::vector<double> & scale,
+                                         const std::vector<double> & shift);
+
+  //! Go back to the dense simulation blocks
+  void clearKroneckerSimulationCorrelation();
+
+  //! Returns ln(det(Sigma)) and sets \c quadraticForm to residual^T Sigma^{-1} residual
+  double lnDeterminant(const V & residual, double & quadraticForm) const;
+
+private:
+  //! sol = (w_basis/w_basis block)^{-1} rhs, with rhs and sol of size numSimulations
+  void simulationSolve(unsigned int basis, const V & rhs, V & sol) const;
+
+  //! ln(det) of the w_basis/w_basis block
+  double simulationLnDeterminant(unsigned int basis) const;
+
+  const BaseEnvironment & m_env;
+
+  unsigned int m_numExperimentRows;
+  unsigned int m_numSimulations;
+  unsigned int m_numCrossRows;
+  std::vector<unsigned int> m_crossRowOffsets;
+
+  Map m_experimentMap;
+  Map m_crossMap;
+  Map m_simulationMap;
+
+  typename SharedPtr<M>::Type m_experimentBlock;
+  std::vector<typename SharedPtr<M>::Type> m_crossBlocks;
+  std::vector<typename SharedPtr<M>::Type> m_simulationBlocks;
+
+  // Kronecker representation of the simulation blocks
+  bool m_kronecker;
+  std::vector<unsigned int> m_scenarioIndex;
+  std::vector<unsigned int> m_parameterIndex;
+  std::vector<double> m_scale;
+  std::vector<double> m_shift;
+  std::vector<double> m_scenarioEigenvalues;
+  std::vector<double> m_parameterEigenvalues;
+  std::vector<double> m_scenarioEigenvectors;  // row major, one eigenvector per column
+  std::vector<double> m_parameterEigenvectors; // row major, one eigenvector per column
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_GPMSA_STRUCTURED_COVARIANCE_H
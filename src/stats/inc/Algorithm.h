@@ -45,8 +45,8 @@ public:
    *
    * This method is called by the delayed rejection procedure.
    */
-  double acceptance_ratio(MarkovChainPositionData<V> x,
-                          MarkovChainPositionData<V> y,
+  double acceptance_ratio(const MarkovChainPositionData<V> & x,
+                          const MarkovChainPositionData<V> & y,
                           const V & tk_pos_x,
                           const V & tk_pos_y);
 private:
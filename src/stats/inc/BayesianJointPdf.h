@@ -77,6 +77,14 @@ public:
   virtual double lnValue(const V & domainVector) const;
   virtual double lnValue(const V & domainVector, V & gradVector) const;
 
+  //! Computes the logarithm of the value of the function at a batch of points.
+  /*! The prior is evaluated point by point, while the likelihood receives the whole batch through
+   * its own lnValues(), so that likelihoods which vectorise across points can do so.  After the
+   * call, lastComputedLogPrior() and lastComputedLogLikelihood() refer to the last point of the
+   * batch. */
+  virtual void lnValues(const std::vector<const V *> & domainVectors,
+                        std::vector<double> & values) const;
+
   //! Mean value of the underlying random variable.
   virtual void   distributionMean (V & /* meanVector */) const { queso_not_implemented(); }
 
@@ -78,6 +78,15 @@ public:
    */
   virtual double lnValue(const V & domainVector) const;
 
+  //! Logarithm of the value of the scalar function at each of \c domainVectors
+  /*!
+   * All misfits are solved for with one multiple right hand side forward
+   * solve per block, against the block's cached Cholesky factor; the
+   * blocks must be symmetric positive definite.
+   */
+  virtual void lnValues(const std::vector<const V *> & domainVectors,
+                        std::vector<double> & values) const;
+
   using LikelihoodBase<V, M>::lnValue;
 
 private:
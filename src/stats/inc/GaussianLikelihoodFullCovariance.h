@@ -26,6 +26,7 @@
 #define UQ_GAUSSIAN_LIKELIHOOD_FULL_COV_H
 
 #include <queso/LikelihoodBase.h>
+#include <queso/ScopedPtr.h>
 
 namespace QUESO {
 
@@ -53,10 +54,19 @@ public:
    * The parameter \c covarianceCoefficient is a multiplying factor of
    * \c covaraince and is fixed (i.e. not solved for in a statistical
    * inversion).
+   *
+   * If \c covarianceIsSymmetricPositiveDefinite is true, \c covariance is
+   * factored once as L L^T at construction and the observations are whitened
+   * there, so that each lnValue() call costs one triangular solve with L and
+   * a dot product, using workspace vectors kept between calls.  The Cholesky
+   * factor is cached by \c covariance itself, which must therefore not be
+   * modified during the lifetime of this object.  Otherwise a (cached) LU
+   * solve is done on each call.
    */
   GaussianLikelihoodFullCovariance(const char * prefix,
       const VectorSet<V, M> & domainSet, const V & observations,
-      const M & covariance, double covarianceCoefficient=1.0);
+      const M & covariance, double covarianceCoefficient=1.0,
+      bool covarianceIsSymmetricPositiveDefinite=false);
 
   //! Destructor
   virtual ~GaussianLikelihoodFullCovariance();
@@ -65,11 +75,28 @@ public:
   //! Logarithm of the value of the scalar function.
   virtual double lnValue(const V & domainVector) const;
 
+  //! Logarithm of the value of the scalar function at each of \c domainVectors
+  /*!
+   * All misfits are solved for with one multiple right hand side solve:
+   * a single level 3 triangular solve in the SPD mode.
+   */
+  virtual void lnValues(const std::vector<const V *> & domainVectors,
+                        std::vector<double> & values) const;
+
   using LikelihoodBase<V, M>::lnValue;
 
 private:
   double m_covarianceCoefficient;
   const M & m_covariance;
+
+  bool m_covarianceIsSymmetricPositiveDefinite;
+
+  //! L^{-1} observations, for covariance = L L^T (SPD mode only)
+  typename ScopedPtr<V>::Type m_whitenedObservations;
+
+  //! Workspace reused between lnValue() calls (SPD mode only)
+  mutable typename ScopedPtr<V>::Type m_modelOutput;
+  mutable typename ScopedPtr<V>::Type m_whitenedMisfit;
 };
 
 }  // End namespace QUESO
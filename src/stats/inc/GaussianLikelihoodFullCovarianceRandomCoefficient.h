@@ -26,6 +26,7 @@
 #define UQ_GAUSSIAN_LIKELIHOOD_FULL_COV_RAND_COEFF_H
 
 #include <queso/LikelihoodBase.h>
+#include <queso/ScopedPtr.h>
 
 namespace QUESO {
 
@@ -58,10 +59,19 @@ public:
    * The parameter \c covarianceCoefficient is a multiplying factor of
    * \c covaraince and is treated as a random variable (i.e. it is solved for
    * in a statistical inversion).
+   *
+   * If \c covarianceIsSymmetricPositiveDefinite is true, \c covariance is
+   * factored once as L L^T at construction, where its log-determinant and the
+   * whitened observations are also computed, so that each lnValue() call
+   * costs one triangular solve with L and a dot product, using workspace
+   * vectors kept between calls.  The Cholesky factor is cached by
+   * \c covariance itself, which must therefore not be modified during the
+   * lifetime of this object.  Otherwise a (cached) LU solve is done on each
+   * call.
    */
   GaussianLikelihoodFullCovarianceRandomCoefficient(const char * prefix,
       const VectorSet<V, M> & domainSet, const V & observations,
-      const M & covariance);
+      const M & covariance, bool covarianceIsSymmetricPositiveDefinite=false);
 
   //! Destructor
   virtual ~GaussianLikelihoodFullCovarianceRandomCoefficient();
@@ -70,10 +80,30 @@ public:
   //! Logarithm of the value of the scalar function.
   virtual double lnValue(const V & domainVector) const;
 
+  //! Logarithm of the value of the scalar function at each of \c domainVectors
+  /*!
+   * All misfits are solved for with one multiple right hand side solve:
+   * a single level 3 triangular solve in the SPD mode.
+   */
+  virtual void lnValues(const std::vector<const V *> & domainVectors,
+                        std::vector<double> & values) const;
+
   using LikelihoodBase<V, M>::lnValue;
 
 private:
   const M & m_covariance;
+
+  bool m_covarianceIsSymmetricPositiveDefinite;
+
+  //! ln(det(covariance)) (SPD mode only)
+  double m_lnDeterminant;
+
+  //! L^{-1} observations, for covariance = L L^T (SPD mode only)
+  typename ScopedPtr<V>::Type m_whitenedObservations;
+
+  //! Workspace reused between lnValue() calls (SPD mode only)
+  mutable typename ScopedPtr<V>::Type m_modelOutput;
+  mutable typename ScopedPtr<V>::Type m_whitenedMisfit;
 };
 
 }  // End namespace QUESO
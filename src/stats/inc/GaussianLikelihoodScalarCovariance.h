@@ -61,6 +61,13 @@ public:
   //! Logarithm of the value of the scalar function.
   virtual double lnValue(const V & domainVector) const;
 
+  //! Logarithm of the value of the scalar function at each of \c domainVectors
+  /*!
+   * The misfits of all points are formed at once by evaluateModels().
+   */
+  virtual void lnValues(const std::vector<const V *> & domainVectors,
+                        std::vector<double> & values) const;
+
   using LikelihoodBase<V, M>::lnValue;
 
 private:
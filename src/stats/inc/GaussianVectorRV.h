@@ -91,6 +91,10 @@ public:
   /*! This method tries to use Cholesky decomposition; and if it fails, the method then
    *  calls a SVD decomposition.*/
   void updateLawCovMatrix(const M& newLawCovMatrix);
+
+  //! Updates the covariance matrix, given its already computed lower Cholesky factor.
+  /*! No factorisation is done, so the update costs O(n^2).*/
+  void updateLawCovMatrix(const M& newLawCovMatrix, const M& newLowerCholLawCovMatrix);
   //@}
 
   //! @name I/O methods
@@ -87,7 +87,7 @@ public:
    * and variance \c m_unifiedLawVarVector and saves it in \c nextValues.*/
   void realization                (V& nextValues) const;
 
-  //! Updates the mean with the new value \c newLawExpVector.
+  //! Updates the mean with the new value \c newLawExpVector (copied in place).
   void updateLawExpVector         (const V& newLawExpVector);
 
   //! Updates the lower triangular matrix from Cholesky decomposition of the covariance matrix to the new value \c newLowerCholLawCovMatrix.
@@ -113,6 +113,10 @@ private:
   V* m_vecSsqrt;
   M* m_matVt;
 
+  //! Scratch storage reused by realization() so that drawing does not allocate.
+  mutable V m_iidGaussianVector;
+  mutable V m_tmpVector;
+
   using BaseVectorRealizer<V,M>::m_env;
   using BaseVectorRealizer<V,M>::m_prefix;
   using BaseVectorRealizer<V,M>::m_unifiedImageSet;
@@ -94,12 +94,32 @@ public:
   virtual void evaluateModel(const V & domainVector, V & modelOutput) const
   { this->evaluateModel(domainVector,NULL,modelOutput,NULL,NULL,NULL); }
 
+  //! Evaluates the user's model at each point of \c domainVectors
+  /*!
+   * Row \c i of the k-by-n_obs matrix \c modelOutputs, with k the number of
+   * points, is filled with the model output at \c *domainVectors[i].
+   *
+   * By default this calls evaluateModel(const V & domainVector, V & modelOutput)
+   * once per point.  Models that can evaluate many points at once should
+   * override it; the canned likelihoods' lnValues() all go through here.
+   */
+  virtual void evaluateModels(const std::vector<const V *> & domainVectors,
+                              M & modelOutputs) const;
+
   //! Actual value of the scalar function.
   virtual double actualValue(const V & domainVector, const V * /*domainDirection*/,
                              V * /*gradVector*/, M * /*hessianMatrix*/, V * /*hessianEffect*/) const
   { return std::exp(this->lnValue(domainVector)); }
 
 protected:
+  //! The n_obs-by-k matrix of misfits, column \c i holding G(x_i) - y
+  /*!
+   * The model is evaluated through evaluateModels().  Laying the misfits out
+   * as columns lets the likelihoods' lnValues() solve for all of them with
+   * one multiple right hand side solve.
+   */
+  M misfitMatrix(const std::vector<const V *> & domainVectors) const;
+
   const V & m_observations;
 };
 
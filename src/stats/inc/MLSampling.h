@@ -41,9 +41,18 @@
 #endif
 #include <sys/time.h>
 #include <fstream>
+#include <deque>
 
 #define ML_CHECKPOINT_FIXED_AMOUNT_OF_DATA 6
 
+#define ML_DYNAMIC_BALANCE_CONTROL_MPI_MSG 2
+#define ML_DYNAMIC_BALANCE_REPLY_MPI_MSG   3
+#define ML_DYNAMIC_BALANCE_STATE_MPI_MSG   4
+#define ML_DYNAMIC_BALANCE_STEAL           0
+#define ML_DYNAMIC_BALANCE_FINISHED        1
+#define ML_DYNAMIC_BALANCE_STEAL_UNSTARTED 2
+#define ML_DYNAMIC_BALANCE_HEADER_SIZE     7
+
 //---------------------------------------------------------
 
 namespace QUESO {
@@ -280,9 +289,10 @@ private:
 
   //! Creates \b unified finite distribution for current level (Step 05 from ML algorithm).
   /*! This method is responsible for the Step 05 in the ML algorithm implemented/described in the method MLSampling<P_V,P_M>::generateSequence.*/
-  /*! @param[in] unifiedRequestedNumSamples, weightSequence
-      @param[out] unifiedIndexCountersAtProc0Only, unifiedWeightStdVectorAtProc0Only */
-  void   generateSequence_Step05_inter0(unsigned int                                    unifiedRequestedNumSamples,         // input
+  /*! @param[in] currOptions, unifiedRequestedNumSamples, weightSequence
+      @param[out] unifiedIndexCountersAtProc0Only, unifiedWeightStdVectorAtProc0Only (left empty if resampling is distributed) */
+  void   generateSequence_Step05_inter0(const MLSamplingLevelOptions*            currOptions,                        // input
+                                        unsigned int                                    unifiedRequestedNumSamples,         // input
                                         const ScalarSequence<double>&            weightSequence,                     // input
                                         std::vector<unsigned int>&                      unifiedIndexCountersAtProc0Only,    // output
                                         std::vector<double>&                            unifiedWeightStdVectorAtProc0Only); // output
@@ -379,12 +389,22 @@ private:
                                         ScalarSequence<double>&                  currLogTargetValues,                // input/output
                                         unsigned int&                                   unifiedNumberOfRejections);         // output
 
-  /*! @param[in] unifiedRequestedNumSamples, unifiedWeightStdVectorAtProc0Only
+  /*! @param[in] currOptions, unifiedRequestedNumSamples, unifiedWeightStdVectorAtProc0Only
       @param[out] unifiedIndexCountersAtProc0Only*/
-  void   sampleIndexes_proc0           (unsigned int                                    unifiedRequestedNumSamples,         // input
+  void   sampleIndexes_proc0           (const MLSamplingLevelOptions*            currOptions,                        // input
+                                        unsigned int                                    unifiedRequestedNumSamples,         // input
                                         const std::vector<double>&                      unifiedWeightStdVectorAtProc0Only,  // input
                                         std::vector<unsigned int>&                      unifiedIndexCountersAtProc0Only);   // output
 
+  //! Same as sampleIndexes_proc0(), but each inter0 process resamples its own part of \c weightSequence.
+  /*! Only the weight sums are exchanged before resampling; the counters are then gathered at proc 0.
+      @param[in] currOptions, unifiedRequestedNumSamples, weightSequence
+      @param[out] unifiedIndexCountersAtProc0Only*/
+  void   sampleIndexes_inter0          (const MLSamplingLevelOptions*            currOptions,                        // input
+                                        unsigned int                                    unifiedRequestedNumSamples,         // input
+                                        const ScalarSequence<double>&            weightSequence,                     // input
+                                        std::vector<unsigned int>&                      unifiedIndexCountersAtProc0Only);   // output
+
   /*! @param[in] currOptions, indexOfFirstWeight, indexOfLastWeight, unifiedIndexCountersAtProc0Only
       @param[out] exchangeStdVec*/
   bool   decideOnBalancedChains_all    (const MLSamplingLevelOptions*            currOptions,                        // input
@@ -441,6 +461,43 @@ private:
                                           ScalarSequence         <double>*         currLogLikelihoodValues,            // output
                                           ScalarSequence         <double>*         currLogTargetValues);               // output
 
+    //! Generates the linked chains of this node segment by segment, letting idle nodes steal the ones not yet finished.
+    /*! Every node starts from its own linked chains in \c linkControl. Between segments of at most
+     *  \c m_loadBalanceSegmentSize positions, the node answers steal requests from idle nodes over
+     *  'inter0Comm' with the linked chain it would have reached last or, once its queue is empty,
+     *  with the rest of its current linked chain if at least two segments of it are left. A rest
+     *  travels with the state of its RNG stream (env_rngStreams), so its samples do not depend on
+     *  where it is continued, and a node that handed one over only steals unstarted linked chains
+     *  afterwards. A node whose queue is empty steals one linked chain at a time until a full round
+     *  over the other nodes comes back empty, waiting for each reply in a blocking probe. Every segment is generated by its own
+     *  MetropolisHastingsSG, started from the last position of the previous one with its known
+     *  log prior and log likelihood; adaptive Metropolis is therefore rejected unless segments
+     *  are whole linked chains.
+     *  @param[in] inputOptions, unifiedCovMatrix, rv, linkControl
+     *  @param[out] workingChain, cumulativeRunTime, cumulativeRejections, currLogLikelihoodValues, currLogTargetValues*/
+    void   generateDynLinkedChains_all   (MLSamplingLevelOptions&                       inputOptions,            // input, only m_rawChainSize changes
+                                          const P_M&                                    unifiedCovMatrix,        // input
+                                          const GenericVectorRV  <P_V,P_M>&             rv,                      // input
+                                          const BalancedLinkedChainsPerNodeStruct<P_V>& linkControl,             // input
+                                          SequenceOfVectors      <P_V,P_M>&             workingChain,            // output
+                                          double&                                       cumulativeRunTime,       // output
+                                          unsigned int&                                 cumulativeRejections,    // output
+                                          ScalarSequence         <double>*              currLogLikelihoodValues, // output
+                                          ScalarSequence         <double>*              currLogTargetValues);    // output
+
+    //! Answers pending steal requests and counts finished nodes; blocks for one message if \c waitForMessage.
+    /*! Once \c chainQueue is empty, a steal request may take the rest of \c currChainBuf, together
+     *  with the state of \c currChainStream if not NULL; \c currChainBuf is then left empty.
+     *  @param[in] numPositionValues, segmentSize, currChainStream, waitForMessage
+     *  @param[in,out] chainQueue, currChainBuf, numFinishedNodes*/
+    void   serveDynLinkedChains_inter0   (unsigned int                                  numPositionValues,       // input
+                                          unsigned int                                  segmentSize,             // input
+                                          const RngBase*                                currChainStream,         // input
+                                          bool                                          waitForMessage,          // input
+                                          std::deque<std::vector<double> >&             chainQueue,              // input/output
+                                          std::vector<double>&                          currChainBuf,            // input/output
+                                          unsigned int&                                 numFinishedNodes);       // input/output
+
 #ifdef QUESO_HAS_GLPK
   /*! @param[in] exchangeStdVec
    *  @param[out] exchangeStdVec*/
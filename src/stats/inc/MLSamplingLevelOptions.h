@@ -51,6 +51,11 @@
 #define UQ_ML_SAMPLING_L_DATA_OUTPUT_ALLOWED_SET_ODV                          ""
 #define UQ_ML_SAMPLING_L_LOAD_BALANCE_ALGORITHM_ID_ODV                        2
 #define UQ_ML_SAMPLING_L_LOAD_BALANCE_TRESHOLD_ODV                            1.
+#define UQ_ML_SAMPLING_L_LOAD_BALANCE_DYNAMIC_ODV                              0
+#define UQ_ML_SAMPLING_L_LOAD_BALANCE_SEGMENT_SIZE_ODV                         10
+#define UQ_ML_SAMPLING_L_RESAMPLING_SCHEME_ODV                                "multinomial"
+#define UQ_ML_SAMPLING_L_RESAMPLING_DISTRIBUTED_ODV                           0
+#define UQ_ML_SAMPLING_L_EXPONENT_SOLVER_ODV                                  "bisection"
 #define UQ_ML_SAMPLING_L_MIN_EFFECTIVE_SIZE_RATIO_ODV                         0.85
 #define UQ_ML_SAMPLING_L_MAX_EFFECTIVE_SIZE_RATIO_ODV                         0.91
 #define UQ_ML_SAMPLING_L_SCALE_COV_MATRIX_ODV                                 1
@@ -194,6 +199,22 @@ public:
   //! Perform load balancing if load unbalancing ratio > threshold.
   double                             m_loadBalanceTreshold;
 
+  //! Let idle subenvironments steal linked chains from busy ones while generating the level.
+  bool                               m_loadBalanceDynamic;
+
+  //! Maximum number of positions generated between two checks for steal requests (0 = whole chains).
+  /*! Each segment is generated by a new MetropolisHastingsSG, so a positive value needs adaptive Metropolis off. */
+  unsigned int                       m_loadBalanceSegmentSize;
+
+  //! Scheme for resampling the previous level: "multinomial", "systematic", "stratified" or "residual".
+  std::string                        m_resamplingScheme;
+
+  //! Resample on every inter0 process, exchanging only prefix sums of the weights.
+  bool                               m_resamplingDistributed;
+
+  //! Search for the next exponent: "bisection", or "newton" (safeguarded Newton, few reductions).
+  std::string                        m_exponentSolver;
+
   //! Minimum allowed effective size ratio wrt previous level.
   double                             m_minEffectiveSizeRatio;
 
@@ -393,6 +414,11 @@ private:
   std::string                   m_option_dataOutputAllowedSet;
   std::string                   m_option_loadBalanceAlgorithmId;
   std::string                   m_option_loadBalanceTreshold;
+  std::string                   m_option_loadBalanceDynamic;
+  std::string                   m_option_loadBalanceSegmentSize;
+  std::string                   m_option_resamplingScheme;
+  std::string                   m_option_resamplingDistributed;
+  std::string                   m_option_exponentSolver;
   std::string                   m_option_minEffectiveSizeRatio;
   std::string                   m_option_maxEffectiveSizeRatio;
   std::string                   m_option_scaleCovMatrix;
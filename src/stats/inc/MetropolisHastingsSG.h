@@ -33,6 +33,7 @@
 #include <queso/ScalarFunctionSynchronizer.h>
 #include <queso/SequenceOfVectors.h>
 #include <queso/ArrayOfSequences.h>
+#include <queso/AsyncSequenceWriter.h>
 #include <sys/time.h>
 #include <fstream>
 #include <queso/SharedPtr.h>
@@ -254,6 +255,15 @@ private:
                                    ScalarSequence<double>*      workingLogLikelihoodValues,
                                    ScalarSequence<double>*      workingLogTargetValues);
 
+  //! Appends the chain position of id \c positionId to the periodic raw chain output
+  /*!
+   * Positions are handed over to the background writers every
+   * \c m_rawChainDataOutputPeriod positions; nothing is written synchronously
+   * and no communication takes place.
+   */
+  void writeRawChainPeriodically(unsigned int                        positionId,
+                                 const MarkovChainPositionData<P_V>& positionData);
+
   //! Adaptive Metropolis method that deals with adapting the proposal covariance matrix
   void adapt(unsigned int positionId,
       BaseVectorSequence<P_V, P_M> & workingChain);
@@ -280,6 +290,32 @@ private:
       const MarkovChainPositionData<P_V> & currentPositionData,
       MarkovChainPositionData<P_V> & currentCandidateData);
 
+  //! Allocates the storage used by \c delayedRejection, so that a DR
+  //! sequence does not allocate. Every slot is initialised to \c position.
+  void   prepareDRWorkspace       (const MarkovChainPositionData<P_V>& position);
+
+  //! Writes a checkpoint of the chain generated up to (and including) position \c positionId.
+  /*! The checkpoint holds everything the chain loop carries from one position to the next:
+   * the chain and its log likelihood/target values, the current position, the adaptive
+   * Metropolis running mean/covariance, the proposal covariance last handed to the TK and the
+   * state of the environment's random number generator.  It is written by subRank 0 of each
+   * subenvironment to '<base>_sub<subId>.restart', through a temporary file so that an interrupted
+   * write leaves the previous checkpoint intact.  State kept inside user supplied transition
+   * kernels (e.g. by an overridden updateTK()) is not part of the checkpoint. */
+  void   writeRestartFile         (unsigned int                               positionId,
+                                   unsigned int                               uniquePos,
+                                   const BaseVectorSequence<P_V,P_M>&  workingChain,
+                                   const ScalarSequence<double>*       workingLogLikelihoodValues,
+                                   const ScalarSequence<double>*       workingLogTargetValues,
+                                   const MarkovChainPositionData<P_V>& currentPositionData) const;
+
+  //! Restores the state written by writeRestartFile() and returns the id of the last position it holds.
+  unsigned int readRestartFile    (BaseVectorSequence<P_V,P_M>&        workingChain,
+                                   ScalarSequence<double>*             workingLogLikelihoodValues,
+                                   ScalarSequence<double>*             workingLogTargetValues,
+                                   MarkovChainPositionData<P_V>&       currentPositionData,
+                                   unsigned int&                              uniquePos);
+
   //! This method reads the chain contents.
   void   readFullChain            (const std::string&                  inputFileName,
                                    const std::string&                  inputFileType,
@@ -288,17 +324,36 @@ private:
 
   //! This method updates the adapted covariance matrix
   /*! This function is called is the option to used adaptive Metropolis was chosen by the user
-   * (via options input file). It performs an adaptation of covariance matrix. */
-  void   updateAdaptedCovMatrix   (const BaseVectorSequence<P_V,P_M>&  subChain,
+   * (via options input file). It folds positions \c idOfFirstPositionInSubChain, ...,
+   * \c idOfFirstPositionInSubChain+numPositions-1 of \c workingChain into the running mean and
+   * covariance, in place and without copying the positions out of the chain.  When possible the
+   * lower Cholesky factor of the adapted covariance is kept up to date with rank-one updates,
+   * so that every folded position costs O(d^2). */
+  void   updateAdaptedCovMatrix   (const BaseVectorSequence<P_V,P_M>&  workingChain,
                                    unsigned int                               idOfFirstPositionInSubChain,
+                                   unsigned int                               numPositions,
                                    double&                                    lastChainSize,
                                    P_V&                                       lastMean,
                                    P_M&                                       lastAdaptedCovMatrix);
 
+  //! Reads position \c positionId of \c workingChain into \c vec, in the space where the proposal is Gaussian.
+  void   getAdaptationPosition    (const BaseVectorSequence<P_V,P_M>&  workingChain,
+                                   unsigned int                               positionId,
+                                   P_V&                                       vec,
+                                   P_V&                                       scratch) const;
+
   //! Calculates acceptance ratio.
-  /*! The acceptance ratio is used to decide whether to accept or reject a candidate. */
-  double alpha                    (const std::vector<MarkovChainPositionData<P_V>*>& inputPositions,
-                                   const std::vector<unsigned int                        >& inputTKStageIds);
+  /*! The acceptance ratio is used to decide whether to accept or reject a candidate.  It is the
+   * delayed rejection acceptance ratio of the run of positions \c first, ..., \c last of the
+   * current DR candidate set (\c first may be greater than \c last for backward runs).  Every
+   * such run is evaluated at most once per candidate set, so a DR stage costs O(n^2) proposal
+   * density evaluations instead of O(2^n). */
+  double alpha                    (unsigned int                               first,
+                                   unsigned int                               last);
+
+  //! Memoized log density of the DR proposal centered at \c center, evaluated at \c target.
+  double drLnProposal             (unsigned int                               center,
+                                   unsigned int                               target);
 
   //! Decides whether or not to accept alpha.
   /*! If either alpha is negative or greater than one, its value will not be accepted.*/
@@ -330,10 +385,29 @@ private:
   double m_lastChainSize;
   typename ScopedPtr<P_V>::Type m_lastMean;
   typename ScopedPtr<P_M>::Type m_lastAdaptedCovMatrix;
+  typename ScopedPtr<P_M>::Type m_lastAdaptedCovLowerChol; // Valid only if m_lastAdaptedCovLowerCholIsValid
+  bool m_lastAdaptedCovLowerCholIsValid;
+  typename ScopedPtr<P_V>::Type m_amPositionVec;
+  typename ScopedPtr<P_V>::Type m_amDiffVec;
+  typename ScopedPtr<P_M>::Type m_tkCovMatrix;    // Last covariance handed to m_tk by adapt(), for restarts
+  typename ScopedPtr<P_M>::Type m_tkCovLowerChol; // Its lower Cholesky factor, if adapt() handed it too
   unsigned int m_numPositionsNotSubWritten;
+  ScopedPtr<AsyncSequenceWriter>::Type m_rawChainWriter;
+  ScopedPtr<AsyncSequenceWriter>::Type m_rawLogLikelihoodWriter;
+  ScopedPtr<AsyncSequenceWriter>::Type m_rawLogTargetWriter;
 
   MHRawChainInfoStruct m_rawChainInfo;
 
+  // Delayed rejection workspace, see prepareDRWorkspace()
+  std::vector<MarkovChainPositionData<P_V>*> m_drPositionsPool;
+  std::vector<MarkovChainPositionData<P_V>*> m_drPositionsData;
+  std::vector<unsigned int> m_drTkStageIds;
+  typename ScopedPtr<P_V>::Type m_drTmpVecValues;
+  std::vector<unsigned int> m_drLnProposalStageIds;
+  std::vector<double> m_drAlphaCache; // Negative entries are not computed yet
+  std::vector<double> m_drLnProposalCache;
+  std::vector<bool> m_drLnProposalIsCached;
+
   ScopedPtr<const MhOptionsValues>::Type m_optionsObj;
 
 	bool m_computeInitialPriorAndLikelihoodValues;
@@ -81,6 +81,7 @@
 #define UQ_MH_SG_DR_MAX_NUM_EXTRA_STAGES_ODV                          0
 #define UQ_MH_SG_DR_LIST_OF_SCALES_FOR_EXTRA_STAGES_ODV               ""
 #define UQ_MH_SG_DR_DURING_AM_NON_ADAPTIVE_INT_ODV                    1
+#define UQ_MH_SG_DR_MEMOIZE_ODV                                       1
 #define UQ_MH_SG_AM_KEEP_INITIAL_MATRIX_ODV                           0
 #define UQ_MH_SG_AM_INIT_NON_ADAPT_INT_ODV                            0
 #define UQ_MH_SG_AM_ADAPT_INTERVAL_ODV                                0
@@ -99,6 +100,9 @@
 #define UQ_MH_SG_ALGORITHM                                            "logit_random_walk"
 #define UQ_MH_SG_TK                                                   "logit_random_walk"
 #define UQ_MH_SG_UPDATE_INTERVAL                                      1
+#define UQ_MH_SG_RESTART_OUTPUT_PERIOD_ODV                            0
+#define UQ_MH_SG_RESTART_OUTPUT_BASE_NAME_FOR_FILES_ODV               "."
+#define UQ_MH_SG_RESTART_INPUT_BASE_NAME_FOR_FILES_ODV                "."
 
 #ifndef QUESO_DISABLE_BOOST_PROGRAM_OPTIONS
 namespace boost {
@@ -504,6 +508,17 @@ public:
    */
   bool                               m_drDuringAmNonAdaptiveInt;
 
+  //! Whether delayed rejection acceptance ratios and proposal densities are memoized.
+  /*!
+   * Both settings give bit-identical chains.  Without memoization every
+   * delayed rejection stage costs O(2^n) proposal density evaluations
+   * again, which is only useful for checking the memoized recursion
+   * against the plain one.
+   *
+   * The default is true.
+   */
+  bool                               m_drMemoize;
+
   //! This option is a no-op.  The default is false.
   bool                               m_amKeepInitialMatrix;
 
@@ -629,6 +644,18 @@ public:
   //! How often to call the TK's updateTK method.  Default is 1.
   unsigned int m_updateInterval;
 
+  //! Write a checkpoint of the chain every this many positions.  Default is 0 (never).
+  unsigned int m_restartOutputPeriod;
+
+  //! Base name of the checkpoint files.  Default is "." (no checkpoints).
+  /*!
+   * Each subenvironment writes <base>_sub<subId>.restart.
+   */
+  std::string m_restartOutputBaseNameForFiles;
+
+  //! Base name of the checkpoint files to resume from.  Default is "." (start afresh).
+  std::string m_restartInputBaseNameForFiles;
+
 private:
   // Cache a pointer to the environment.
   const BaseEnvironment * m_env;
@@ -717,6 +744,8 @@ private:
   std::string                   m_option_dr_listOfScalesForExtraStages;
   //! Option name for MhOptionsValues::m_drDuringAmNonAdaptiveInt.  Option name is m_prefix + "mh_dr_duringAmNonAdaptiveInt"
   std::string                   m_option_dr_duringAmNonAdaptiveInt;
+  //! Option name for MhOptionsValues::m_drMemoize.  Option name is m_prefix + "mh_dr_memoize"
+  std::string                   m_option_dr_memoize;
   //! Option name for MhOptionsValues::m_amKeepInitialMatrix.  Option name is m_prefix + "mh_am_keepInitialMatrix"
   std::string                   m_option_am_keepInitialMatrix;
   //! Option name for MhOptionsValues::m_amInitialNonAdaptInterval.  Option name is m_prefix + "mh_am_initialNonAdaptInterval"
@@ -756,6 +785,12 @@ private:
   std::string                   m_option_tk;
   //! Option name for MhOptionsValues::m_updateInterval.  Option name is m_prefix + "mh_updateInterval"
   std::string                   m_option_updateInterval;
+  //! Option name for MhOptionsValues::m_restartOutputPeriod.  Option name is m_prefix + "mh_restartOutput_period"
+  std::string                   m_option_restartOutput_period;
+  //! Option name for MhOptionsValues::m_restartOutputBaseNameForFiles.  Option name is m_prefix + "mh_restartOutput_baseNameForFiles"
+  std::string                   m_option_restartOutput_baseNameForFiles;
+  //! Option name for MhOptionsValues::m_restartInputBaseNameForFiles.  Option name is m_prefix + "mh_restartInput_baseNameForFiles"
+  std::string                   m_option_restartInput_baseNameForFiles;
 
   //! Copies the option values from \c src to \c this.
   void copy(const MhOptionsValues& src);
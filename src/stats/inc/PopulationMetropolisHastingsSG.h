@@ -0,0 +1,141 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_POPULATION_MH_SG_H
+#define UQ_POPULATION_MH_SG_H
+
+#include <queso/MetropolisHastingsSGOptions.h>
+#include <queso/VectorRV.h>
+#include <queso/VectorSpace.h>
+#include <queso/ScalarFunctionSynchronizer.h>
+#include <queso/VectorSequence.h>
+#include <queso/ScalarSequence.h>
+#include <queso/ScopedPtr.h>
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*!
+ * \file PopulationMetropolisHastingsSG.h
+ * \brief A templated class that advances a population of Metropolis-Hastings chains in lockstep.
+ *
+ * \class PopulationMetropolisHastingsSG
+ * \brief A templated class that advances a population of Metropolis-Hastings chains in lockstep.
+ *
+ * This class runs many independent random walk Metropolis-Hastings chains inside one
+ * subenvironment.  At every step one candidate is drawn for each chain, and all candidates that
+ * lie inside the target support are handed to the target PDF in a single call to
+ * BaseScalarFunction::lnValues().  Targets (typically likelihoods) that vectorise across
+ * parameter points therefore see batches as wide as the population, instead of one point at a
+ * time.
+ *
+ * Every chain uses the same Gaussian proposal, with the covariance matrix given to the
+ * constructor.  Candidates outside the target support are rejected without evaluating the
+ * target.  Options are read by class 'MhOptionsValues'; only the raw chain size and the
+ * verbosity options are used, since delayed rejection and adaptation are specific to
+ * MetropolisHastingsSG.
+ *
+ * With env_rngStreams every chain draws its proposals and acceptance tests from its own RNG
+ * stream, keyed by the subenvironment and the chain index, so each chain's samples do not depend
+ * on the size of the population. */
+
+template <class P_V = GslVector, class P_M = GslMatrix>
+class PopulationMetropolisHastingsSG
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor.
+  /*! One chain is run for each entry of \c initialPositions.  The constructor reads input options
+   * that begin with the string '\<prefix\>_mh_', unless \c alternativeOptionsValues is not NULL. */
+  PopulationMetropolisHastingsSG(const char*                    prefix,
+                                 const MhOptionsValues*         alternativeOptionsValues,
+                                 const BaseVectorRV<P_V,P_M>&   sourceRv,
+                                 const std::vector<const P_V*>& initialPositions,
+                                 const P_M&                     proposalCovMatrix);
+
+  //! Destructor
+  ~PopulationMetropolisHastingsSG();
+  //@}
+
+  //! @name Statistical methods
+  //@{
+  //! Method to generate the chains.
+  /*! All chains are written into \c workingChain, which is resized to numChains() times the raw
+   * chain size: chain \c c occupies positions \c c*rawChainSize up to \c (c+1)*rawChainSize-1.
+   * If not NULL, \c workingLogTargetValues is filled in the same layout. */
+  void         generateSequence   (BaseVectorSequence<P_V,P_M>& workingChain,
+                                   ScalarSequence<double>*      workingLogTargetValues);
+
+  //! Number of chains in the population.
+  unsigned int numChains          () const;
+
+  //! Number of accepted candidates of chain \c chainId during the last call to generateSequence().
+  unsigned int numAccepted        (unsigned int chainId) const;
+
+  //! Number of candidates, over all chains, that fell outside the target support.
+  unsigned int numOutOfTargetSupport() const;
+
+  //! Number of batched calls to the target PDF during the last call to generateSequence().
+  unsigned int numTargetBatches   () const;
+  //@}
+
+private:
+  //! Evaluates the target at every candidate inside its support, in a single batch.
+  void   evaluateCandidates       ();
+
+  const BaseEnvironment&        m_env;
+  const VectorSpace<P_V,P_M>&   m_vectorSpace;
+  const BaseJointPdf<P_V,P_M>&  m_targetPdf;
+  typename ScopedPtr<const MhOptionsValues>::Type m_optionsObj;
+
+  P_M m_proposalLowerChol;
+  P_V m_gaussianVector;
+  typename ScopedPtr<const ScalarFunctionSynchronizer<P_V,P_M> >::Type m_targetPdfSynchronizer;
+
+  // One entry per chain; the position and candidate vectors are owned and
+  // swapped on acceptance
+  std::vector<P_V*>         m_positions;
+  std::vector<P_V*>         m_candidates;
+  std::vector<double>       m_logTargets;
+  std::vector<double>       m_candidateLogTargets;
+  std::vector<bool>         m_candidateInTargetSupport;
+  std::vector<unsigned int> m_numAccepted;
+
+  //! One RNG stream per chain with env_rngStreams, empty otherwise
+  std::vector<RngBase*>     m_chainStreams;
+
+  // Workspace for the batched target calls
+  std::vector<const P_V*>   m_batchPositions;
+  std::vector<double>       m_batchLogTargets;
+
+  unsigned int m_numOutOfTargetSupport;
+  unsigned int m_numTargetBatches;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_POPULATION_MH_SG_H
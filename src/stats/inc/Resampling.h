@@ -0,0 +1,81 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_RESAMPLING_H
+#define UQ_RESAMPLING_H
+
+#include <string>
+#include <vector>
+
+namespace QUESO {
+
+class RngBase;
+class MpiComm;
+
+/*! \file Resampling.h
+ * \brief Resampling of a weighted sample.
+ *
+ * Given nonnegative, unnormalized weights \f$ w_i \f$, these functions decide how many copies
+ * \f$ n_i \f$ of each index to keep so that \f$ \sum_i n_i = N \f$ and
+ * \f$ E[n_i] = N w_i / \sum_j w_j \f$. The supported schemes are:
+ *
+ * - "systematic": one uniform \f$ U \f$, points \f$ (k + U)/N \f$, \f$ k = 0, \ldots, N-1 \f$;
+ * - "stratified": one uniform per stratum, points \f$ (k + U_k)/N \f$;
+ * - "residual": \f$ \lfloor N w_i / \sum_j w_j \rfloor \f$ copies deterministically, and the
+ *   remaining ones drawn systematically from the fractional parts.
+ *
+ * The points are increasing, so all schemes are a single sweep over the cumulative weights:
+ * O(n + N) time with no auxiliary search structure.  ("multinomial" resampling, drawing N independent
+ * indexes, remains available through FiniteDistribution.)
+ */
+
+//! Returns whether \c scheme is a name accepted by ResampleIndexCounts().
+bool ResamplingSchemeIsValid(const std::string& scheme);
+
+//! Returns whether \c scheme can be used by ResampleIndexCountsDistributed().
+bool ResamplingSchemeIsDistributable(const std::string& scheme);
+
+//! Resamples \c numSamples indexes from \c weights with \c scheme; \c counts[i] is the number of copies of index \c i.
+void ResampleIndexCounts(const std::string&         scheme,
+                         unsigned int               numSamples,
+                         const std::vector<double>& weights,
+                         const RngBase&             rng,
+                         std::vector<unsigned int>& counts);
+
+/*! \brief Same as ResampleIndexCounts(), for weights distributed over the processes of \c comm.
+ *
+ * Each process passes its own part of the weights, the unified weights being the concatenation of
+ * the parts in rank order, and gets the counts of its own part.  Only the per-process weight sums
+ * are exchanged, in one collective ("systematic") or two ("residual").  The uniform is drawn by
+ * rank 0.  "stratified" needs one uniform per stratum and is not supported. */
+void ResampleIndexCountsDistributed(const std::string&         scheme,
+                                    unsigned int               numSamples,
+                                    const std::vector<double>& subWeights,
+                                    const RngBase&             rng,
+                                    const MpiComm&             comm,
+                                    std::vector<unsigned int>& subCounts);
+
+}  // End namespace QUESO
+
+#endif // UQ_RESAMPLING_H
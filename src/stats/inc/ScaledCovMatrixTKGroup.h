@@ -71,6 +71,11 @@ public:
   //! Scales the covariance matrix.
   /*! The covariance matrix is scaled by a factor of \f$ 1/scales^2 \f$.*/
   virtual void updateLawCovMatrix(const M & covMatrix);
+
+  //! Scales the covariance matrix and its lower Cholesky factor, avoiding a
+  //! factorisation per stage.
+  virtual void updateLawCovMatrixAndLowerChol(const M & covMatrix,
+                                              const M & lowerCholCovMatrix);
   //@}
 
   //! @name Misc methods
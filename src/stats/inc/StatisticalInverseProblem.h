@@ -27,6 +27,7 @@
 
 #include <queso/StatisticalInverseProblemOptions.h>
 #include <queso/MetropolisHastingsSG.h>
+#include <queso/PopulationMetropolisHastingsSG.h>
 #include <queso/MLSampling.h>
 #include <queso/InstantiateIntersection.h>
 #include <queso/VectorRealizer.h>
@@ -207,6 +208,18 @@ public:
    */
   void solveWithBayesMetropolisHastings();
 
+  //! Solves the problem via Bayes formula and a population of lockstep Metropolis-Hastings chains.
+  /*!
+   * One chain is started at each entry of \c initialValues, and all chains share the Gaussian
+   * proposal with covariance \c proposalCovMatrix.  At every step the candidates of all chains
+   * are handed to the likelihood in a single BaseScalarFunction::lnValues() call.  All chains are
+   * stored back to back in chain(); see PopulationMetropolisHastingsSG for the layout.  Only the
+   * raw chain size and verbosity options of \c alternativeOptionsValues are used.
+   */
+  void solveWithBayesPopulationMetropolisHastings(const MhOptionsValues*         alternativeOptionsValues,
+                                                  const std::vector<const P_V*>& initialValues,
+                                                  const P_M&                     proposalCovMatrix);
+
   //! Seeds the chain with the result of a deterministic optimisation
   /*!
    * This only works for Metropolis-Hastings right now.  Multi-level is not
@@ -274,6 +287,7 @@ private:
   typename ScopedPtr<BaseVectorRealizer  <P_V,P_M> >::Type m_solutionRealizer;
 
   typename ScopedPtr<MetropolisHastingsSG<P_V,P_M> >::Type m_mhSeqGenerator;
+  typename ScopedPtr<PopulationMetropolisHastingsSG<P_V,P_M> >::Type m_populationMhSeqGenerator;
   typename ScopedPtr<MLSampling          <P_V,P_M> >::Type m_mlSampler;
   typename ScopedPtr<BaseVectorSequence  <P_V,P_M> >::Type m_chain;
   ScopedPtr<ScalarSequence<double> >::Type m_logLikelihoodValues;
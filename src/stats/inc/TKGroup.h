@@ -123,6 +123,16 @@ public:
    * factor of \f$ 1/scales^2 \f$.
    */
   virtual void updateLawCovMatrix(const M & covMatrix) = 0;
+
+  //! Sets the proposal covariance matrix when its lower Cholesky factor is
+  //! already known.
+  /*!
+   * Used by adaptive Metropolis, which keeps the factor of the adapted
+   * covariance up to date with rank-one updates.  The default ignores
+   * \c lowerCholCovMatrix and calls updateLawCovMatrix(covMatrix).
+   */
+  virtual void updateLawCovMatrixAndLowerChol(const M & covMatrix,
+                                              const M & lowerCholCovMatrix);
   //@}
 
   //! @name I/O methods
@@ -138,6 +148,7 @@ protected:
   const VectorSpace<V,M>*                m_vectorSpace;
         std::vector<double>              m_scales;
         std::vector<const V*>            m_preComputingPositions;
+        std::vector<V*>                  m_preComputingStorage; // Reused by m_preComputingPositions
         std::vector<BaseVectorRV<V,M>* > m_rvs; // Gaussian, not Base... And nothing const...
   unsigned int m_stageId;
 };
@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_TEMPERING_EXPONENT_SOLVER_H
+#define UQ_TEMPERING_EXPONENT_SOLVER_H
+
+#include <vector>
+
+namespace QUESO {
+
+class MpiComm;
+
+/*! \file TemperingExponentSolver.h
+ * \brief Solver for the next tempering exponent of MLSampling.
+ *
+ * \class TemperingExponentSolver
+ * \brief Finds the tempering increment that gives a prescribed effective sample size ratio.
+ *
+ * Going from one level to the next weights the previous chain by \f$ w_i = \exp(s \ell_i) \f$,
+ * where \f$ \ell_i \f$ are the (cached) log-likelihood values and \f$ s \f$ is the increment
+ * scale.  With \f$ S_1 = \sum_i w_i \f$, \f$ S_2 = \sum_i w_i^2 \f$ and \f$ N \f$ positions, the
+ * effective sample size ratio is \f$ r(s) = S_1^2 / (N S_2) \f$, which decreases from 1 at
+ * \f$ s = 0 \f$.  The sums, and the sums weighted by \f$ \ell_i \f$ giving \f$ r'(s) \f$, are
+ * computed for several scales in one sweep over the contiguous log-likelihoods and reduced in one
+ * collective.  solve() brackets the root of \f$ r(s) - r_{target} \f$ and, in every round,
+ * evaluates a Newton step in \f$ \log s \f$ together with a logarithmic grid over the bracket.
+ * It usually stops after two or three rounds instead of the dozens that bisection needs.
+ *
+ * All exponentials are shifted by \f$ s \max_i \ell_i \f$, so no sum overflows and
+ * \f$ S_1 \ge 1 \f$.
+ */
+class TemperingExponentSolver
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Caches the log-likelihoods of this process; \c comm joins the parts held by all processes.
+  TemperingExponentSolver(const MpiComm& comm, const std::vector<double>& subLogLikelihoods);
+
+  //! Destructor
+  ~TemperingExponentSolver();
+  //@}
+
+  //! @name Evaluation methods
+  //@{
+  //! Unified weight sums, effective sample size ratios and their derivatives at each of \c scales.
+  void evaluate(const std::vector<double>& scales,
+                std::vector<double>&       weightSums,
+                std::vector<double>&       effectiveSizeRatios,
+                std::vector<double>&       ratioDerivatives) const;
+
+  //! Logarithm of the evidence factor, the mean of the unshifted weights, at \c scale.
+  double lnEvidenceFactor(double scale, double weightSum) const;
+
+  //! Normalized weights of this process at \c scale.
+  void normalizedWeights(double scale, double weightSum, std::vector<double>& subWeights) const;
+  //@}
+
+  //! @name Solver methods
+  //@{
+  /*! \brief Finds a scale in (0, \c maxScale] whose ratio lies in [\c minRatio, \c maxRatio].
+   *
+   * \c maxScale is accepted if its ratio is above \c targetRatio, as the bisection of MLSampling
+   * does for an exponent of 1.  Returns the scale and sets its weight sum, its ratio and the
+   * number of collective rounds used. */
+  double solve(double        maxScale,
+               double        minRatio,
+               double        targetRatio,
+               double        maxRatio,
+               double&       weightSum,
+               double&       effectiveSizeRatio,
+               unsigned int& numRounds) const;
+  //@}
+
+private:
+  const MpiComm&      m_comm;
+  std::vector<double> m_logLikelihoods;
+  double              m_maxLogLikelihood;
+  double              m_unifiedSize;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_TEMPERING_EXPONENT_SOLVER_H
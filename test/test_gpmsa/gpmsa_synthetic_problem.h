@@ -0,0 +1,170 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2017 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef QUESO_TEST_GPMSA_SYNTHETIC_PROBLEM_H
+#define QUESO_TEST_GPMSA_SYNTHETIC_PROBLEM_H
+
+#include <queso/GslVector.h>
+#include <queso/GslMatrix.h>
+#include <queso/UniformVectorRV.h>
+#include <queso/VectorSet.h>
+#include <queso/GPMSA.h>
+#include <queso/ScopedPtr.h>
+
+#include <cmath>
+#include <vector>
+
+// A small calibration problem for the GPMSA tests that check one way of
+// computing a quantity against another.  The "simulator" is a smooth
+// function of one scenario and two uncertain parameters in [0,1], with
+// numEta outputs that are not linearly dependent.  The experiments are the
+// simulator at theta = (0.4, 0.6), slightly perturbed, with observation
+// error variance 0.01 on each output.
+//
+// If numGridScenarios is nonzero, simulation j sits at scenario
+// j % numGridScenarios and parameter point j / numGridScenarios, a full
+// grid of scenarios times parameters; otherwise the design is space
+// filling.  With dimScenario = 0 there are no scenario parameters, and
+// the simulator is evaluated at scenario 0.5.
+//
+// The caller sets up opts before construction, which adds all the data
+// and so builds the emulator.
+class SyntheticGPMSAProblem
+{
+public:
+  SyntheticGPMSAProblem(const QUESO::FullEnvironment & env,
+                        QUESO::GPMSAOptions & opts,
+                        unsigned int numEta,
+                        unsigned int numSimulations,
+                        unsigned int numExperiments,
+                        unsigned int numGridScenarios = 0,
+                        unsigned int dimScenario = 1)
+    :
+    paramSpace(env, "param_", 2, NULL),
+    paramMins(paramSpace.zeroVector()),
+    paramMaxs(paramSpace.zeroVector()),
+    configSpace(env, "scenario_", dimScenario, NULL),
+    nEtaSpace(env, "output_", numEta, NULL)
+  {
+    paramMaxs.cwSet(1.0);
+    paramDomain.reset(new QUESO::BoxSubset<>("param_", paramSpace,
+                                             paramMins, paramMaxs));
+    priorRv.reset(new QUESO::UniformVectorRV<>("prior_", *paramDomain));
+
+    gpmsaFactory.reset(new QUESO::GPMSAFactory<>(env,
+                                                 &opts,
+                                                 *priorRv,
+                                                 configSpace,
+                                                 paramSpace,
+                                                 nEtaSpace,
+                                                 numSimulations,
+                                                 numExperiments));
+
+    std::vector<QUESO::SharedPtr<QUESO::GslVector>::Type>
+      simulationScenarios(numSimulations);
+    std::vector<QUESO::SharedPtr<QUESO::GslVector>::Type>
+      paramVecs(numSimulations);
+    std::vector<QUESO::SharedPtr<QUESO::GslVector>::Type>
+      outputVecs(numSimulations);
+
+    for (unsigned int i = 0; i < numSimulations; i++) {
+      simulationScenarios[i].reset(new QUESO::GslVector(configSpace.zeroVector()));
+      paramVecs          [i].reset(new QUESO::GslVector(paramSpace.zeroVector()));
+      outputVecs         [i].reset(new QUESO::GslVector(nEtaSpace.zeroVector()));
+
+      // Golden ratio and sqrt(2) sequences fill the parameter square
+      unsigned int a = i, c = i;
+      unsigned int numA = numSimulations;
+      if (numGridScenarios) {
+        a = i % numGridScenarios;
+        c = i / numGridScenarios;
+        numA = numGridScenarios;
+      }
+      const double x = dimScenario ? (a + 0.5) / numA : 0.5;
+      if (dimScenario)
+        (*simulationScenarios[i])[0] = x;
+      (*paramVecs[i])[0] = std::fmod(0.1 + 0.6180339887 * c, 1.0);
+      (*paramVecs[i])[1] = std::fmod(0.3 + 0.4142135624 * c, 1.0);
+
+      for (unsigned int k = 0; k < numEta; k++)
+        (*outputVecs[i])[k] = output(x, (*paramVecs[i])[0],
+                                     (*paramVecs[i])[1], k);
+    }
+
+    std::vector<QUESO::SharedPtr<QUESO::GslVector>::Type>
+      experimentScenarios(numExperiments);
+    std::vector<QUESO::SharedPtr<QUESO::GslVector>::Type>
+      experimentVecs(numExperiments);
+    std::vector<QUESO::SharedPtr<QUESO::GslMatrix>::Type>
+      experimentMats(numExperiments);
+
+    for (unsigned int i = 0; i < numExperiments; i++) {
+      experimentScenarios[i].reset(new QUESO::GslVector(configSpace.zeroVector()));
+      experimentVecs     [i].reset(new QUESO::GslVector(nEtaSpace.zeroVector()));
+      experimentMats     [i].reset(new QUESO::GslMatrix(nEtaSpace.zeroVector()));
+
+      const double x = dimScenario ? (i + 0.25) / numExperiments : 0.5;
+      if (dimScenario)
+        (*experimentScenarios[i])[0] = x;
+      for (unsigned int k = 0; k < numEta; k++) {
+        (*experimentVecs[i])[k] = output(x, 0.4, 0.6, k) +
+                                  0.05 * std::cos(3.0 * i + k);
+        (*experimentMats[i])(k,k) = 0.01;
+      }
+    }
+
+    gpmsaFactory->addSimulations(simulationScenarios, paramVecs, outputVecs);
+    gpmsaFactory->addExperiments(experimentScenarios, experimentVecs,
+                                 experimentMats);
+  }
+
+  QUESO::GPMSAFactory<> & factory() { return *gpmsaFactory; }
+
+  // Fills point with a hyperparameter point away from any bound: the
+  // prior mean, with each entry shrunk by a different small factor
+  void interiorPoint(QUESO::GslVector & point) const
+  {
+    gpmsaFactory->prior().pdf().distributionMean(point);
+    for (unsigned int k = 0; k < point.sizeLocal(); k++)
+      point[k] *= 1.0 - 0.05 * (k % 4);
+  }
+
+  static double output(double x, double t0, double t1, unsigned int k)
+  {
+    return std::sin(2.0 * x + (k + 1) * t0) + (k + 1) * t1 * t1 * x +
+           0.3 * k * t0 * t1 * x * x;
+  }
+
+private:
+  QUESO::VectorSpace<> paramSpace;
+  QUESO::GslVector paramMins;
+  QUESO::GslVector paramMaxs;
+  QUESO::ScopedPtr<QUESO::BoxSubset<> >::Type paramDomain;
+  QUESO::ScopedPtr<QUESO::UniformVectorRV<> >::Type priorRv;
+  QUESO::VectorSpace<> configSpace;
+  QUESO::VectorSpace<> nEtaSpace;
+  QUESO::ScopedPtr<QUESO::GPMSAFactory<> >::Type gpmsaFactory;
+};
+
+#endif